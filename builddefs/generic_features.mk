@@ -19,6 +19,7 @@ SEND_STRING_ENABLE ?= yes
 SPACE_CADET_ENABLE ?= yes
 
 GENERIC_FEATURES = \
+    ADAPTIVE_TAPPING_TERM \
     AUTO_SHIFT \
     AUTOCORRECT \
     BOOTMAGIC \
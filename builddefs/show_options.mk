@@ -38,6 +38,7 @@ OTHER_OPTION_NAMES = \
   UNICODE_COMMON \
   AUTO_SHIFT_ENABLE \
   DYNAMIC_TAPPING_TERM_ENABLE \
+  ADAPTIVE_TAPPING_TERM_ENABLE \
   COMBO_ENABLE \
   KEY_LOCK_ENABLE \
   KEY_OVERRIDE_ENABLE \
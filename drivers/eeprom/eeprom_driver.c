@@ -49,6 +49,7 @@ void eeprom_write_dword(uint32_t *addr, uint32_t value) {
     eeprom_write_block(&value, addr, 4);
 }
 
+void eeprom_update_block(const void *buf, void *addr, size_t len) __attribute__((weak));
 void eeprom_update_block(const void *buf, void *addr, size_t len) {
     uint8_t read_buf[len];
     eeprom_read_block(read_buf, addr, len);
@@ -83,3 +84,8 @@ void eeprom_driver_format(bool erase) {
     (void)erase; /* The default implementation assumes that the eeprom must be erased in order to be usable. */
     eeprom_driver_erase();
 }
+
+void eeprom_driver_task(void) __attribute__((weak));
+void eeprom_driver_task(void) {
+    /* Most drivers have no background work to do. */
+}
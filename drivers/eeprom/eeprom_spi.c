@@ -223,3 +223,27 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     spi_write(CMD_WRDI);
     spi_stop();
 }
+
+/* Compares and rewrites one EEPROM page at a time, so only the pages whose contents changed are written. */
+void eeprom_update_block(const void *buf, void *addr, size_t len) {
+    uint8_t        read_buf[EXTERNAL_EEPROM_PAGE_SIZE];
+    const uint8_t *source      = (const uint8_t *)buf;
+    uintptr_t      target_addr = (uintptr_t)addr;
+
+    while (len > 0) {
+        uintptr_t page_offset  = target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
+        size_t    chunk_length = EXTERNAL_EEPROM_PAGE_SIZE - page_offset;
+        if (chunk_length > len) {
+            chunk_length = len;
+        }
+
+        eeprom_read_block(read_buf, (const void *)target_addr, chunk_length);
+        if (memcmp(source, read_buf, chunk_length) != 0) {
+            eeprom_write_block(source, (void *)target_addr, chunk_length);
+        }
+
+        source += chunk_length;
+        target_addr += chunk_length;
+        len -= chunk_length;
+    }
+}
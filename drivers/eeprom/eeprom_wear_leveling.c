@@ -6,6 +6,17 @@
 #include "eeprom_driver.h"
 #include "wear_leveling.h"
 
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+#    include "keyboard.h"
+#    ifndef WEAR_LEVELING_CONSOLIDATE_IDLE_TIME
+#        define WEAR_LEVELING_CONSOLIDATE_IDLE_TIME 500
+#    endif
+#endif
+
+#ifndef EEPROM_WEAR_LEVELING_UPDATE_CHUNK
+#    define EEPROM_WEAR_LEVELING_UPDATE_CHUNK 8
+#endif
+
 void eeprom_driver_init(void) {
     wear_leveling_init();
 }
@@ -20,10 +31,40 @@ void eeprom_driver_erase(void) {
     wear_leveling_erase();
 }
 
+void eeprom_driver_task(void) {
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+    /* The erase waits for typing to pause. Once it is done, the stored data is blank until the
+     * consolidated area is programmed, so the remaining steps are taken regardless. */
+    if (wear_leveling_consolidation_in_progress() || last_input_activity_elapsed() >= WEAR_LEVELING_CONSOLIDATE_IDLE_TIME) {
+        wear_leveling_task();
+    }
+#endif
+}
+
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
-    wear_leveling_read((uint32_t)addr, buf, len);
+    wear_leveling_read((uint32_t)(uintptr_t)addr, buf, len);
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
-    wear_leveling_write((uint32_t)addr, buf, len);
+    wear_leveling_write((uint32_t)(uintptr_t)addr, buf, len);
+}
+
+/* Hands the data to the write log in aligned chunks, wear_leveling_write() drops the ones matching
+ * the cache so an update only logs the parts of the block that changed. */
+void eeprom_update_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *source  = (const uint8_t *)buf;
+    uint32_t       address = (uint32_t)(uintptr_t)addr;
+
+    while (len > 0) {
+        size_t chunk_length = EEPROM_WEAR_LEVELING_UPDATE_CHUNK - (address % EEPROM_WEAR_LEVELING_UPDATE_CHUNK);
+        if (chunk_length > len) {
+            chunk_length = len;
+        }
+
+        wear_leveling_write(address, source, chunk_length);
+
+        source += chunk_length;
+        address += chunk_length;
+        len -= chunk_length;
+    }
 }
@@ -248,3 +248,15 @@ void snled27351_sw_shutdown(uint8_t index) {
     // Write SW Sleep Register
     snled27351_write_register(index, SNLED27351_FUNCTION_REG_SOFTWARE_SLEEP, SNLED27351_SOFTWARE_SLEEP_ENABLE);
 }
+
+void snled27351_sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < SNLED27351_DRIVER_COUNT; i++) {
+        snled27351_sw_return_normal(i);
+    }
+}
+
+void snled27351_sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < SNLED27351_DRIVER_COUNT; i++) {
+        snled27351_sw_shutdown(i);
+    }
+}
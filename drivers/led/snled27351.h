@@ -188,6 +188,8 @@ void snled27351_flush(void);
 
 void snled27351_sw_return_normal(uint8_t index);
 void snled27351_sw_shutdown(uint8_t index);
+void snled27351_sw_return_normal_all(void);
+void snled27351_sw_shutdown_all(void);
 
 #define CB1_CA1 0x00
 #define CB1_CA2 0x01
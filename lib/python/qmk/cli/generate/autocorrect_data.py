@@ -165,6 +165,20 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
+def make_leaf_data(typo: str, correction: str) -> List[int]:
+    """Makes the serialized leaf for a typo: the backspace count followed by the null-terminated correction."""
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0  # Make the autocorrection data for this entry and serialize it.
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    correction = correction[i:]
+    bs_count = [backspaces + 128]
+    return bs_count + list(bytes(correction, 'ascii')) + [0]
+
+
 def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
     """Serializes trie and correction data in a form readable by the C code.
   Args:
@@ -179,18 +193,7 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
             typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
+            entry = {'data': make_leaf_data(typo, correction), 'links': [], 'byte_offset': 0}
             table.append(entry)
         elif len(trie_node) == 1:  # Handle trie node with a single child.
             c, trie_node = next(iter(trie_node.items()))
@@ -232,6 +235,55 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
+def serialize_automaton(autocorrections: List[Tuple[str, str]]) -> List[int]:
+    """Serializes the typos as an Aho-Corasick automaton readable by the C code.
+  Unlike the trie, which is walked backwards from the newest keypress, the
+  automaton is fed one keypress at a time and carries its state across them.
+  The trie of typos is written forwards, and each node gets a failure link to
+  the node for its longest proper suffix that is also in the trie.
+  Args:
+    autocorrections: List of (typo, correction) tuples.
+  Returns:
+    List of ints in the range 0-255.
+  """
+    nodes = [{'children': {}, 'fail': 0, 'leaf': None, 'byte_offset': 0}]
+    for typo, correction in autocorrections:
+        node = 0
+        for letter in typo:
+            key = TYPO_CHARS[letter]
+            if key not in nodes[node]['children']:
+                nodes[node]['children'][key] = len(nodes)
+                nodes.append({'children': {}, 'fail': 0, 'leaf': None, 'byte_offset': 0})
+            node = nodes[node]['children'][key]
+        nodes[node]['leaf'] = (typo, correction)
+
+    # Breadth first, so that a node's failure link is known before its children's.
+    order = [0]
+    for node in order:
+        for key, child in sorted(nodes[node]['children'].items()):
+            if node != 0:
+                fail = nodes[node]['fail']
+                while key not in nodes[fail]['children'] and fail != 0:
+                    fail = nodes[fail]['fail']
+                nodes[child]['fail'] = nodes[fail]['children'].get(key, 0)
+            order.append(child)
+
+    def serialize(node: Dict[str, Any]) -> List[int]:
+        if node['leaf']:  # No typo contains another, so leaves have no children.
+            return make_leaf_data(*node['leaf'])
+        data = [len(node['children'])] + encode_link(nodes[node['fail']])
+        for key, child in sorted(node['children'].items()):
+            data += [key] + encode_link(nodes[child])
+        return data
+
+    byte_offset = 0
+    for index in order:  # To encode links, first compute byte offset of each node.
+        nodes[index]['byte_offset'] = byte_offset
+        byte_offset += len(serialize(nodes[index]))
+
+    return [b for index in order for b in serialize(nodes[index])]
+
+
 def encode_link(link: Dict[str, Any]) -> List[int]:
     """Encodes a node link as two bytes."""
     byte_offset = link['byte_offset']
@@ -254,11 +306,15 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('-a', '--automaton', arg_only=True, action='store_true', help="Generate a streaming automaton, which checks each keypress in constant time, instead of a trie")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
-    trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.automaton:
+        data = serialize_automaton(autocorrections)
+    else:
+        trie = make_trie(autocorrections)
+        data = serialize_trie(autocorrections, trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,6 +338,8 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if cli.args.automaton:
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_AUTOMATON')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
@@ -0,0 +1,145 @@
+"""Generate leader_data.h, the leader sequence table compiled into a trie.
+
+Each line of the table file maps a sequence of keycodes, typed after the leader
+key, to the keycode tapped when it matches, with the syntax "keys -> action".
+Blank lines or lines starting with '#' are ignored.
+Example:
+  KC_E KC_M        -> QK_USER_0
+  KC_S KC_S        -> KC_PSCR
+  KC_S KC_S KC_A   -> LCTL(KC_PSCR)
+For full documentation, see QMK Docs
+"""
+
+import textwrap
+from typing import Any, Dict, Iterator, List, Tuple
+
+from milc import cli
+
+from qmk.commands import dump_lines
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.keyboard import keyboard_completer, keyboard_folder
+from qmk.keymap import keymap_completer, locate_keymap
+from qmk.path import normpath
+from qmk.util import maybe_exit
+
+# Size of leader_sequence[] in quantum/leader.c
+LEADER_SEQUENCE_MAX = 5
+
+
+def parse_file_lines(file_name: str) -> Iterator[Tuple[int, List[str], str]]:
+    """Parses lines read from `file_name` into sequence-action pairs."""
+
+    line_number = 0
+    for line in open(file_name, 'rt'):
+        line_number += 1
+        line = line.strip()
+        if line and line[0] != '#':
+            tokens = [token.strip() for token in line.split('->', 1)]
+            if len(tokens) != 2 or not tokens[0] or not tokens[1]:
+                cli.log.error('{fg_red}Error:%d:{fg_reset} Invalid syntax: "{fg_cyan}%s{fg_reset}"', line_number, line)
+                maybe_exit(1)
+
+            yield line_number, tokens[0].split(), tokens[1]
+
+
+def parse_file(file_name: str) -> List[Tuple[List[str], str]]:
+    """Parses the leader table file.
+  The function validates that sequences fit in the leader sequence buffer and
+  that no sequence is given twice.
+  Args:
+    file_name: String, path of the leader table.
+  Returns:
+    List of (sequence, action) tuples.
+  """
+
+    sequences = []
+    seen = set()
+    for line_number, keys, action in parse_file_lines(file_name):
+        if tuple(keys) in seen:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Duplicate sequence: "{fg_cyan}%s{fg_reset}"', line_number, ' '.join(keys))
+            maybe_exit(1)
+        if len(keys) > LEADER_SEQUENCE_MAX:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Sequence is longer than %d keys: "{fg_cyan}%s{fg_reset}"', line_number, LEADER_SEQUENCE_MAX, ' '.join(keys))
+            maybe_exit(1)
+        if action in ('0', 'KC_NO', 'XXXXXXX'):
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Sequence "{fg_cyan}%s{fg_reset}" has no action', line_number, ' '.join(keys))
+            maybe_exit(1)
+
+        sequences.append((keys, action))
+        seen.add(tuple(keys))
+
+    return sequences
+
+
+def serialize_trie(sequences: List[Tuple[List[str], str]]) -> List[str]:
+    """Serializes the sequences as a trie of 16-bit words readable by the C code.
+  Each node is its number of children, then its action or KC_NO, then a
+  (keycode, node index) pair for each child. A node without children always
+  has an action, which fires as soon as it is reached.
+  Args:
+    sequences: List of (sequence, action) tuples.
+  Returns:
+    List of C expressions, one for each word.
+  """
+    nodes: List[Dict[str, Any]] = [{'children': {}, 'action': 'KC_NO'}]
+    for keys, action in sequences:
+        node = 0
+        for key in keys:
+            if key not in nodes[node]['children']:
+                nodes[node]['children'][key] = len(nodes)
+                nodes.append({'children': {}, 'action': 'KC_NO'})
+            node = nodes[node]['children'][key]
+        nodes[node]['action'] = action
+
+    offsets = []
+    offset = 0
+    for node in nodes:
+        offsets.append(offset)
+        offset += 2 + 2 * len(node['children'])
+    assert offset <= 0xffff
+
+    data = []
+    for node in nodes:
+        data += [str(len(node['children'])), node['action']]
+        for key, child in node['children'].items():
+            data += [key, str(offsets[child])]
+    return data
+
+
+@cli.argument('filename', type=normpath, help='The leader table file')
+@cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to build a firmware for. Ignored when a configurator export is supplied.')
+@cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
+@cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.subcommand('Generate the leader sequence table from a table file.')
+def generate_leader_data(cli):
+    sequences = parse_file(cli.args.filename)
+    if not sequences:
+        cli.log.error('{fg_red}Error:{fg_reset} No leader sequences in "{fg_cyan}%s{fg_reset}"', cli.args.filename)
+        maybe_exit(1)
+    data = serialize_trie(sequences)
+
+    current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_leader_data.keyboard
+    current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_leader_data.keymap
+
+    if current_keyboard and current_keymap:
+        cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'leader_data.h'
+
+    longest = max(len(' '.join(keys)) for keys, _ in sequences)
+
+    # Build the leader_data.h file.
+    leader_data_h_lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '']
+
+    leader_data_h_lines.append(f'// Leader sequences ({len(sequences)} entries):')
+    for keys, action in sequences:
+        leader_data_h_lines.append(f'//   {" ".join(keys):<{longest}} -> {action}')
+
+    leader_data_h_lines.append('')
+    leader_data_h_lines.append(f'#define LEADER_TABLE_SIZE {len(data)}')
+    leader_data_h_lines.append('')
+    leader_data_h_lines.append('static const uint16_t leader_table[LEADER_TABLE_SIZE] PROGMEM = {')
+    leader_data_h_lines.append(textwrap.fill('    %s' % (', '.join(data)), width=100, subsequent_indent='    ', break_long_words=False, break_on_hyphens=False))
+    leader_data_h_lines.append('};')
+
+    # Show the results
+    dump_lines(cli.args.output, leader_data_h_lines, cli.args.quiet)
@@ -2,10 +2,15 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 #include <stdbool.h>
 #include <hal.h>
+#include "util.h"
 #include "timer.h"
 #include "wear_leveling.h"
 #include "wear_leveling_internal.h"
 
+#ifndef WEAR_LEVELING_EFL_BULK_COUNT
+#    define WEAR_LEVELING_EFL_BULK_COUNT 32
+#endif // WEAR_LEVELING_EFL_BULK_COUNT
+
 static flash_offset_t base_offset = UINT32_MAX;
 
 #if defined(WEAR_LEVELING_EFL_FIRST_SECTOR)
@@ -143,6 +148,30 @@ bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return flashProgram(flash, offset, sizeof(value), (const uint8_t *)&value) == FLASH_NO_ERROR;
 }
 
+bool backing_store_write_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
+    uint32_t            offset = (base_offset + address);
+    backing_store_int_t temp[WEAR_LEVELING_EFL_BULK_COUNT];
+    while (item_count > 0) {
+        size_t this_loop = MIN(item_count, WEAR_LEVELING_EFL_BULK_COUNT);
+        bs_dprintf("Write ");
+        wl_dump(offset, values, sizeof(backing_store_int_t) * this_loop);
+
+        for (size_t i = 0; i < this_loop; ++i) {
+            temp[i] = flash_erased_is_one ? ~values[i] : values[i];
+        }
+
+        // Program the whole run in one go rather than a flash operation per value
+        if (flashProgram(flash, offset, sizeof(backing_store_int_t) * this_loop, (const uint8_t *)temp) != FLASH_NO_ERROR) {
+            return false;
+        }
+
+        offset += this_loop * sizeof(backing_store_int_t);
+        values += this_loop;
+        item_count -= this_loop;
+    }
+    return true;
+}
+
 bool backing_store_lock(void) {
     bs_dprintf("Lock  \n");
     eflStop(&EFLD1);
@@ -184,3 +213,22 @@ bool backing_store_allow_ecc_errors(void) {
 void backing_store_signal_ecc_error(void) {
     ecc_error_occurred = true;
 }
+
+bool backing_store_read_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
+    uint32_t             offset = (base_offset + address);
+    backing_store_int_t *loc    = (backing_store_int_t *)flashGetOffsetAddress(flash, offset);
+    is_issuing_read             = true;
+    ecc_error_occurred          = false;
+    for (size_t i = 0; i < item_count; ++i) {
+        values[i] = flash_erased_is_one ? ~loc[i] : loc[i];
+    }
+    is_issuing_read = false;
+    if (ecc_error_occurred) {
+        bs_dprintf("Failed to read from backing store, ECC error detected\n");
+        ecc_error_occurred = false;
+        return false;
+    }
+    bs_dprintf("Read  ");
+    wl_dump(offset, values, sizeof(backing_store_int_t) * item_count);
+    return true;
+}
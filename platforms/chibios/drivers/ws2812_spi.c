@@ -1,4 +1,5 @@
 #include "ws2812.h"
+#include "ws2812_spi_encoder.h"
 #include "gpio.h"
 #include "util.h"
 #include "chibios_config.h"
@@ -113,54 +114,51 @@
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+#define TXBUF_SIZE (PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE)
 
-/*
- * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
- */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
+// With double buffering the next frame is encoded while the previous one is still being sent.
+// The circular buffer is sent continuously from a single buffer, so it cannot be doubled.
+#if defined(WS2812_SPI_DOUBLE_BUFFER) && !defined(WS2812_SPI_USE_CIRCULAR_BUFFER) && !defined(WS2812_SPI_SYNC)
+#    define TXBUF_COUNT 2
+#else
+#    define TXBUF_COUNT 1
+#endif
+
+static uint8_t txbuf[TXBUF_COUNT][TXBUF_SIZE] = {0};
+#if TXBUF_COUNT > 1
+static uint8_t txbuf_next = 0;
+#endif
+
+#if !defined(WS2812_SPI_USE_CIRCULAR_BUFFER) && !defined(WS2812_SPI_SYNC)
+static volatile bool tx_busy = false;
+
+static void ws2812_spi_end_cb(SPIDriver* spip) {
+    tx_busy = false;
 }
 
-static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+#    define WS2812_SPI_END_CB ws2812_spi_end_cb
+#else
+#    define WS2812_SPI_END_CB NULL
+#endif
+
+static void set_led_color_rgb(uint8_t* buffer, ws2812_led_t color, int pos) {
+    uint8_t* tx_led = &buffer[PREAMBLE_SIZE + BYTES_FOR_LED * pos];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    ws2812_spi_encode_byte(tx_led, color.g);
+    ws2812_spi_encode_byte(tx_led + BYTES_FOR_LED_BYTE, color.r);
+    ws2812_spi_encode_byte(tx_led + BYTES_FOR_LED_BYTE * 2, color.b);
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    ws2812_spi_encode_byte(tx_led, color.r);
+    ws2812_spi_encode_byte(tx_led + BYTES_FOR_LED_BYTE, color.g);
+    ws2812_spi_encode_byte(tx_led + BYTES_FOR_LED_BYTE * 2, color.b);
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
+    ws2812_spi_encode_byte(tx_led, color.b);
+    ws2812_spi_encode_byte(tx_led + BYTES_FOR_LED_BYTE, color.g);
+    ws2812_spi_encode_byte(tx_led + BYTES_FOR_LED_BYTE * 2, color.r);
 #endif
 #ifdef WS2812_RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 3 + j] = get_protocol_eq(color.w, j);
+    ws2812_spi_encode_byte(tx_led + BYTES_FOR_LED_BYTE * 3, color.w);
 #endif
 }
 
@@ -180,7 +178,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -199,8 +197,8 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
-        NULL, // error_cb
+        WS2812_SPI_END_CB, // data_cb
+        NULL,              // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(AT32F415)
@@ -220,7 +218,7 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
 #endif
 }
 
@@ -240,17 +238,35 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
+#if TXBUF_COUNT > 1
+    uint8_t* buffer = txbuf[txbuf_next];
+#else
+    uint8_t* buffer = txbuf[0];
+#    if !defined(WS2812_SPI_USE_CIRCULAR_BUFFER) && !defined(WS2812_SPI_SYNC)
+    // the only buffer may still be on its way out
+    while (tx_busy) {
+    }
+#    endif
+#endif
+
     for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
+        set_led_color_rgb(buffer, ws2812_leds[i], i);
     }
 
-    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
+    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, so the previous frame may still be
+    // sending. Instead spiSend can be used to send synchronously by defining WS2812_SPI_SYNC.
 #ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
 #    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, buffer);
 #    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+#        if TXBUF_COUNT > 1
+    // the previous frame was sent from the other buffer while this one was encoded
+    while (tx_busy) {
+    }
+    txbuf_next ^= 1;
+#        endif
+    tx_busy = true;
+    spiStartSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, buffer);
 #    endif
 #endif
 }
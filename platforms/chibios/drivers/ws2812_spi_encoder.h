@@ -0,0 +1,34 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * The SPI driver sends each bit of colour data as a nibble on the wire, 0b1110 for a one and
+ * 0b1000 for a zero, so every byte of colour data expands to four bytes. Expanding a nibble at
+ * a time through this table replaces testing each bit individually.
+ */
+#define WS2812_SPI_BIT_PAIR(bits) ((((bits)&2) ? 0xE0 : 0x80) | (((bits)&1) ? 0x0E : 0x08))
+#define WS2812_SPI_NIBBLE(nibble) {WS2812_SPI_BIT_PAIR((nibble) >> 2), WS2812_SPI_BIT_PAIR((nibble)&3)}
+
+// clang-format off
+static const uint8_t ws2812_spi_nibble_lut[16][2] = {
+    WS2812_SPI_NIBBLE(0x0), WS2812_SPI_NIBBLE(0x1), WS2812_SPI_NIBBLE(0x2), WS2812_SPI_NIBBLE(0x3),
+    WS2812_SPI_NIBBLE(0x4), WS2812_SPI_NIBBLE(0x5), WS2812_SPI_NIBBLE(0x6), WS2812_SPI_NIBBLE(0x7),
+    WS2812_SPI_NIBBLE(0x8), WS2812_SPI_NIBBLE(0x9), WS2812_SPI_NIBBLE(0xA), WS2812_SPI_NIBBLE(0xB),
+    WS2812_SPI_NIBBLE(0xC), WS2812_SPI_NIBBLE(0xD), WS2812_SPI_NIBBLE(0xE), WS2812_SPI_NIBBLE(0xF),
+};
+// clang-format on
+
+/* Expand one byte of colour data into the four bytes sent for it, most significant bit first. */
+static inline void ws2812_spi_encode_byte(uint8_t *out, uint8_t data) {
+    const uint8_t *high = ws2812_spi_nibble_lut[data >> 4];
+    const uint8_t *low  = ws2812_spi_nibble_lut[data & 0x0F];
+
+    out[0] = high[0];
+    out[1] = high[1];
+    out[2] = low[0];
+    out[3] = low[1];
+}
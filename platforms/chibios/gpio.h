@@ -43,3 +43,22 @@ typedef ioline_t pin_t;
 #define gpio_read_pin(pin) palReadLine(pin)
 
 #define gpio_toggle_pin(pin) palToggleLine(pin)
+
+/* Operation of GPIO by port. */
+
+typedef ioportid_t   gpio_port_t;
+typedef ioportmask_t gpio_port_data_t;
+
+#define gpio_pin_port(pin) PAL_PORT(pin)
+#define gpio_pin_bit(pin) PAL_PAD(pin)
+
+#define gpio_read_port(port) palReadPort(port)
+
+/* Pin-change interrupts, calling back on either edge. Requires PAL_USE_CALLBACKS. */
+
+#define gpio_enable_pin_interrupt(pin, callback)              \
+    do {                                                      \
+        palSetLineCallback((pin), (callback), NULL);          \
+        palEnableLineEvent((pin), PAL_EVENT_MODE_BOTH_EDGES); \
+    } while (0)
+#define gpio_disable_pin_interrupt(pin) palDisableLineEvent(pin)
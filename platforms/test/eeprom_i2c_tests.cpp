@@ -0,0 +1,107 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "eeprom.h"
+#include "i2c_master_mock.h"
+}
+
+/* Same size as a four layer, 6x15 dynamic keymap, moved the way VIA does in 28 byte chunks. */
+#define KEYMAP_SIZE (4 * 6 * 15 * 2)
+#define KEYMAP_ADDR 37
+#define VIA_CHUNK 28
+
+class EepromI2c : public testing::Test {
+   public:
+    void SetUp() override {
+        i2c_mock_reset();
+    }
+
+    static uint32_t transactions() {
+        return i2c_mock_transmits + i2c_mock_receives;
+    }
+
+    static void clear_counters() {
+        i2c_mock_transmits   = 0;
+        i2c_mock_receives    = 0;
+        i2c_mock_page_writes = 0;
+        i2c_mock_wait_ms     = 0;
+    }
+
+    static std::vector<uint8_t> pattern(size_t length, uint8_t seed) {
+        std::vector<uint8_t> data(length);
+        for (size_t i = 0; i < length; i++) {
+            data[i] = (uint8_t)(i * 7 + seed);
+        }
+        return data;
+    }
+
+    static size_t pages_spanned(uintptr_t addr, size_t length) {
+        return (addr + length - 1) / EXTERNAL_EEPROM_PAGE_SIZE - addr / EXTERNAL_EEPROM_PAGE_SIZE + 1;
+    }
+};
+
+TEST_F(EepromI2c, UpdateBlockRoundTrip) {
+    auto data = pattern(100, 3);
+    eeprom_update_block(data.data(), (void *)KEYMAP_ADDR, data.size());
+
+    std::vector<uint8_t> readback(data.size());
+    eeprom_read_block(readback.data(), (const void *)KEYMAP_ADDR, readback.size());
+    EXPECT_EQ(readback, data);
+    EXPECT_EQ(i2c_mock_eeprom[KEYMAP_ADDR - 1], 0);
+    EXPECT_EQ(i2c_mock_eeprom[KEYMAP_ADDR + data.size()], 0);
+}
+
+TEST_F(EepromI2c, UpdateBlockSkipsUnchangedPages) {
+    auto data = pattern(100, 3);
+    eeprom_update_block(data.data(), (void *)KEYMAP_ADDR, data.size());
+    EXPECT_EQ(i2c_mock_page_writes, pages_spanned(KEYMAP_ADDR, data.size()));
+
+    clear_counters();
+    eeprom_update_block(data.data(), (void *)KEYMAP_ADDR, data.size());
+    EXPECT_EQ(i2c_mock_page_writes, 0);
+    EXPECT_EQ(i2c_mock_receives, pages_spanned(KEYMAP_ADDR, data.size()));
+    EXPECT_EQ(i2c_mock_wait_ms, 0);
+}
+
+TEST_F(EepromI2c, UpdateBlockWritesOnlyChangedPages) {
+    auto data = pattern(100, 3);
+    eeprom_update_block(data.data(), (void *)KEYMAP_ADDR, data.size());
+
+    clear_counters();
+    data[50] ^= 0xFF;
+    eeprom_update_block(data.data(), (void *)KEYMAP_ADDR, data.size());
+    EXPECT_EQ(i2c_mock_page_writes, 1);
+    EXPECT_EQ(i2c_mock_eeprom[KEYMAP_ADDR + 50], data[50]);
+}
+
+TEST_F(EepromI2c, FullKeymapSyncTransactions) {
+    auto keymap = pattern(KEYMAP_SIZE, 11);
+
+    /* The old path, one read and possibly one write transaction per byte. */
+    clear_counters();
+    for (size_t i = 0; i < KEYMAP_SIZE; i++) {
+        eeprom_update_byte((uint8_t *)(uintptr_t)(KEYMAP_ADDR + i), keymap[i]);
+    }
+    uint32_t byte_transactions = transactions(), byte_wait_ms = i2c_mock_wait_ms;
+
+    /* The block path, one page read and at most one page write per page in each chunk. */
+    i2c_mock_reset();
+    for (size_t offset = 0; offset < KEYMAP_SIZE; offset += VIA_CHUNK) {
+        size_t length = KEYMAP_SIZE - offset < VIA_CHUNK ? KEYMAP_SIZE - offset : VIA_CHUNK;
+        eeprom_update_block(&keymap[offset], (void *)(uintptr_t)(KEYMAP_ADDR + offset), length);
+    }
+    uint32_t block_transactions = transactions(), block_wait_ms = i2c_mock_wait_ms;
+
+    std::vector<uint8_t> readback(KEYMAP_SIZE);
+    eeprom_read_block(readback.data(), (const void *)KEYMAP_ADDR, readback.size());
+    EXPECT_EQ(readback, keymap);
+    EXPECT_LT(block_transactions * 10, byte_transactions);
+    EXPECT_LT(block_wait_ms * 10, byte_wait_ms);
+
+    std::cout << "Syncing a " << KEYMAP_SIZE << " byte keymap: " << byte_transactions << " transactions and " << byte_wait_ms << "ms of write cycles byte by byte, " << block_transactions << " transactions and " << block_wait_ms << "ms in blocks" << std::endl;
+}
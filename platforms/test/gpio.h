@@ -0,0 +1,69 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Simulated GPIO: 16 ports of 16 pins, the port in the high nibble of a pin and its bit in the low
+ * nibble. Pins are wired together through switches, see gpio_mock.h. */
+
+typedef uint8_t pin_t;
+
+#define TEST_PIN(port, bit) ((pin_t)((port) << 4 | (bit)))
+
+/* Operation of GPIO by pin. */
+
+#define gpio_set_pin_input(pin) test_gpio_set_pin_mode((pin), TEST_GPIO_INPUT)
+#define gpio_set_pin_input_high(pin) test_gpio_set_pin_mode((pin), TEST_GPIO_INPUT_PULLUP)
+#define gpio_set_pin_input_low(pin) test_gpio_set_pin_mode((pin), TEST_GPIO_INPUT_PULLDOWN)
+#define gpio_set_pin_output_push_pull(pin) test_gpio_set_pin_mode((pin), TEST_GPIO_OUTPUT)
+#define gpio_set_pin_output_open_drain(pin) test_gpio_set_pin_mode((pin), TEST_GPIO_OUTPUT)
+#define gpio_set_pin_output(pin) gpio_set_pin_output_push_pull(pin)
+
+#define gpio_write_pin_high(pin) test_gpio_write_pin((pin), true)
+#define gpio_write_pin_low(pin) test_gpio_write_pin((pin), false)
+#define gpio_write_pin(pin, level) test_gpio_write_pin((pin), (level))
+
+#define gpio_read_pin(pin) test_gpio_read_pin(pin)
+
+#define gpio_toggle_pin(pin) test_gpio_write_pin((pin), !test_gpio_read_pin(pin))
+
+/* Operation of GPIO by port. */
+
+typedef uint8_t  gpio_port_t;
+typedef uint16_t gpio_port_data_t;
+
+#define gpio_pin_port(pin) ((pin) >> 4)
+#define gpio_pin_bit(pin) ((pin)&0xF)
+
+#define gpio_read_port(port) test_gpio_read_port(port)
+
+/* Pin-change interrupts, calling back on either edge. */
+
+#define gpio_enable_pin_interrupt(pin, callback) test_gpio_set_pin_interrupt((pin), (callback))
+#define gpio_disable_pin_interrupt(pin) test_gpio_set_pin_interrupt((pin), NULL)
+
+typedef void (*test_gpio_callback_t)(void *arg);
+
+typedef enum {
+    TEST_GPIO_INPUT,
+    TEST_GPIO_INPUT_PULLUP,
+    TEST_GPIO_INPUT_PULLDOWN,
+    TEST_GPIO_OUTPUT,
+} test_gpio_mode_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void             test_gpio_set_pin_mode(pin_t pin, test_gpio_mode_t mode);
+void             test_gpio_write_pin(pin_t pin, bool level);
+bool             test_gpio_read_pin(pin_t pin);
+gpio_port_data_t test_gpio_read_port(gpio_port_t port);
+void             test_gpio_set_pin_interrupt(pin_t pin, test_gpio_callback_t callback);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,119 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "gpio.h"
+#include "gpio_mock.h"
+
+typedef struct {
+    pin_t a;
+    pin_t b;
+    bool  closed;
+} gpio_mock_switch_t;
+
+uint32_t gpio_mock_pin_reads;
+uint32_t gpio_mock_port_reads;
+uint32_t gpio_mock_interrupts;
+
+static test_gpio_mode_t     gpio_mock_modes[TEST_GPIO_PORTS][16];
+static bool                 gpio_mock_levels[TEST_GPIO_PORTS][16];
+static test_gpio_callback_t gpio_mock_callbacks[TEST_GPIO_PORTS][16];
+static bool                 gpio_mock_last_levels[TEST_GPIO_PORTS][16];
+static gpio_mock_switch_t   gpio_mock_switches[TEST_GPIO_SWITCHES];
+static uint16_t             gpio_mock_switch_count;
+
+void gpio_mock_reset(void) {
+    memset(gpio_mock_modes, 0, sizeof(gpio_mock_modes));
+    memset(gpio_mock_levels, 0, sizeof(gpio_mock_levels));
+    memset(gpio_mock_callbacks, 0, sizeof(gpio_mock_callbacks));
+    gpio_mock_switch_count = 0;
+    gpio_mock_pin_reads    = 0;
+    gpio_mock_port_reads   = 0;
+    gpio_mock_interrupts   = 0;
+}
+
+// Whether a closed switch connects the pin to an output at the given level
+static bool gpio_mock_driven(pin_t pin, bool level) {
+    for (uint16_t i = 0; i < gpio_mock_switch_count; i++) {
+        gpio_mock_switch_t *sw = &gpio_mock_switches[i];
+        if (sw->closed && (sw->a == pin || sw->b == pin)) {
+            pin_t other = sw->a == pin ? sw->b : sw->a;
+            if (gpio_mock_modes[gpio_pin_port(other)][gpio_pin_bit(other)] == TEST_GPIO_OUTPUT && gpio_mock_levels[gpio_pin_port(other)][gpio_pin_bit(other)] == level) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool gpio_mock_level(pin_t pin) {
+    uint8_t port = gpio_pin_port(pin), bit = gpio_pin_bit(pin);
+    switch (gpio_mock_modes[port][bit]) {
+        case TEST_GPIO_OUTPUT:
+            return gpio_mock_levels[port][bit];
+        case TEST_GPIO_INPUT_PULLUP:
+            return !gpio_mock_driven(pin, false);
+        default:
+            return gpio_mock_driven(pin, true);
+    }
+}
+
+// Calls back every pin with an interrupt enabled whose level has changed
+static void gpio_mock_check_interrupts(void) {
+    for (uint8_t port = 0; port < TEST_GPIO_PORTS; port++) {
+        for (uint8_t bit = 0; bit < 16; bit++) {
+            if (gpio_mock_callbacks[port][bit]) {
+                bool level = gpio_mock_level(TEST_PIN(port, bit));
+                if (level != gpio_mock_last_levels[port][bit]) {
+                    gpio_mock_last_levels[port][bit] = level;
+                    gpio_mock_interrupts++;
+                    gpio_mock_callbacks[port][bit](NULL);
+                }
+            }
+        }
+    }
+}
+
+void gpio_mock_set_switch(pin_t a, pin_t b, bool closed) {
+    for (uint16_t i = 0; i < gpio_mock_switch_count; i++) {
+        gpio_mock_switch_t *sw = &gpio_mock_switches[i];
+        if ((sw->a == a && sw->b == b) || (sw->a == b && sw->b == a)) {
+            sw->closed = closed;
+            gpio_mock_check_interrupts();
+            return;
+        }
+    }
+    if (gpio_mock_switch_count < TEST_GPIO_SWITCHES) {
+        gpio_mock_switches[gpio_mock_switch_count++] = (gpio_mock_switch_t){.a = a, .b = b, .closed = closed};
+        gpio_mock_check_interrupts();
+    }
+}
+
+void test_gpio_set_pin_mode(pin_t pin, test_gpio_mode_t mode) {
+    gpio_mock_modes[gpio_pin_port(pin)][gpio_pin_bit(pin)] = mode;
+    gpio_mock_check_interrupts();
+}
+
+void test_gpio_write_pin(pin_t pin, bool level) {
+    gpio_mock_levels[gpio_pin_port(pin)][gpio_pin_bit(pin)] = level;
+    gpio_mock_check_interrupts();
+}
+
+bool test_gpio_read_pin(pin_t pin) {
+    gpio_mock_pin_reads++;
+    return gpio_mock_level(pin);
+}
+
+gpio_port_data_t test_gpio_read_port(gpio_port_t port) {
+    gpio_port_data_t data = 0;
+    gpio_mock_port_reads++;
+    for (uint8_t bit = 0; bit < 16; bit++) {
+        data |= (gpio_port_data_t)gpio_mock_level(TEST_PIN(port, bit)) << bit;
+    }
+    return data;
+}
+
+void test_gpio_set_pin_interrupt(pin_t pin, test_gpio_callback_t callback) {
+    gpio_mock_callbacks[gpio_pin_port(pin)][gpio_pin_bit(pin)]   = callback;
+    gpio_mock_last_levels[gpio_pin_port(pin)][gpio_pin_bit(pin)] = gpio_mock_level(pin);
+}
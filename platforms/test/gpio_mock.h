@@ -0,0 +1,22 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+#define TEST_GPIO_PORTS 16
+#define TEST_GPIO_SWITCHES 256
+
+extern uint32_t gpio_mock_pin_reads;
+extern uint32_t gpio_mock_port_reads;
+extern uint32_t gpio_mock_interrupts;
+
+void gpio_mock_reset(void);
+
+/* Opens or closes a switch between two pins. An input reads the level of an output it is switched
+ * to, and otherwise its pull, so each switch behaves as if it had an ideal diode towards the
+ * output. Pins with an interrupt enabled call back as soon as their level changes. */
+void gpio_mock_set_switch(pin_t a, pin_t b, bool closed);
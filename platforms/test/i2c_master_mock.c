@@ -0,0 +1,64 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "i2c_master.h"
+#include "eeprom_i2c.h"
+#include "i2c_master_mock.h"
+
+/* Stands in for a 24xx-series EEPROM on the bus, counting every transaction made with it. */
+uint8_t  i2c_mock_eeprom[EXTERNAL_EEPROM_BYTE_COUNT];
+uint32_t i2c_mock_transmits;
+uint32_t i2c_mock_receives;
+uint32_t i2c_mock_page_writes;
+uint32_t i2c_mock_wait_ms;
+
+static uint32_t i2c_mock_pointer;
+
+void i2c_mock_reset(void) {
+    memset(i2c_mock_eeprom, 0x00, sizeof(i2c_mock_eeprom));
+    i2c_mock_transmits   = 0;
+    i2c_mock_receives    = 0;
+    i2c_mock_page_writes = 0;
+    i2c_mock_wait_ms     = 0;
+    i2c_mock_pointer     = 0;
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    i2c_mock_transmits++;
+    if (length < EXTERNAL_EEPROM_ADDRESS_SIZE) {
+        return I2C_STATUS_ERROR;
+    }
+
+    i2c_mock_pointer = 0;
+    for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; i++) {
+        i2c_mock_pointer = (i2c_mock_pointer << 8) | data[i];
+    }
+    if (length == EXTERNAL_EEPROM_ADDRESS_SIZE) {
+        // Address only, sets up a following read
+        return I2C_STATUS_SUCCESS;
+    }
+
+    // Like the real parts, writes past the end of a page wrap around to its start
+    uint32_t page = i2c_mock_pointer - (i2c_mock_pointer % EXTERNAL_EEPROM_PAGE_SIZE);
+    for (uint16_t i = EXTERNAL_EEPROM_ADDRESS_SIZE; i < length; i++) {
+        i2c_mock_eeprom[i2c_mock_pointer % EXTERNAL_EEPROM_BYTE_COUNT] = data[i];
+        i2c_mock_pointer                                               = page + ((i2c_mock_pointer + 1) % EXTERNAL_EEPROM_PAGE_SIZE);
+    }
+    i2c_mock_page_writes++;
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_receive(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout) {
+    i2c_mock_receives++;
+    for (uint16_t i = 0; i < length; i++) {
+        data[i] = i2c_mock_eeprom[i2c_mock_pointer++ % EXTERNAL_EEPROM_BYTE_COUNT];
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+void wait_ms(uint32_t ms) {
+    i2c_mock_wait_ms += ms;
+}
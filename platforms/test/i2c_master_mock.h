@@ -0,0 +1,15 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "eeprom_i2c.h"
+
+extern uint8_t  i2c_mock_eeprom[EXTERNAL_EEPROM_BYTE_COUNT];
+extern uint32_t i2c_mock_transmits;
+extern uint32_t i2c_mock_receives;
+extern uint32_t i2c_mock_page_writes;
+extern uint32_t i2c_mock_wait_ms;
+
+void i2c_mock_reset(void);
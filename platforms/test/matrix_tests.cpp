@@ -0,0 +1,201 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <functional>
+#include <iostream>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "wait.h"
+#include "gpio_mock.h"
+}
+
+using matrix_t = std::array<matrix_row_t, MATRIX_ROWS>;
+
+/* Called from the scan that finds the matrix released, between reading it and going idle. */
+static std::function<void()> on_release;
+
+extern "C" void matrix_scan_kb(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (matrix_get_row(row)) {
+            return;
+        }
+    }
+    if (on_release) {
+        on_release();
+        on_release = nullptr;
+    }
+}
+
+#ifdef DIRECT_PINS
+static const pin_t direct_pins[MATRIX_ROWS][MATRIX_COLS] = DIRECT_PINS;
+#else
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+#endif
+
+class Matrix : public testing::Test {
+   public:
+    void SetUp() override {
+        gpio_mock_reset();
+#ifdef DIRECT_PINS
+        gpio_set_pin_output(MATRIX_TEST_GROUND_PIN);
+        gpio_write_pin_low(MATRIX_TEST_GROUND_PIN);
+#endif
+        matrix_init();
+        pressed = {};
+    }
+
+    void set_key(uint8_t row, uint8_t col, bool down) {
+#ifdef DIRECT_PINS
+        pin_t pin = direct_pins[row][col];
+        gpio_mock_set_switch(pin, MATRIX_TEST_GROUND_PIN, down);
+#else
+        pin_t pin = col_pins[col];
+        gpio_mock_set_switch(row_pins[row], pin, down);
+#endif
+        if (down && pin != NO_PIN) {
+            pressed[row] |= MATRIX_ROW_SHIFTER << col;
+        } else {
+            pressed[row] &= ~(MATRIX_ROW_SHIFTER << col);
+        }
+    }
+
+    matrix_t scan() {
+        matrix_t rows;
+        matrix_scan();
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            rows[row] = matrix_get_row(row);
+        }
+        return rows;
+    }
+
+    /* Scans for as long as debouncing takes. */
+    matrix_t settle() {
+        matrix_t rows = scan();
+        for (uint8_t i = 0; i < DEBOUNCE; i++) {
+            wait_ms(1);
+            rows = scan();
+        }
+        return rows;
+    }
+
+    uint32_t gpio_reads() {
+        return gpio_mock_pin_reads + gpio_mock_port_reads;
+    }
+
+    uint32_t next(uint32_t range) {
+        seed = seed * 1664525 + 1013904223;
+        return (seed >> 8) % range;
+    }
+
+    matrix_t pressed;
+    uint32_t seed = 0x2545F491;
+};
+
+TEST_F(Matrix, ReadsEachKeyOnItsOwn) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            set_key(row, col, true);
+            EXPECT_EQ(settle(), pressed) << "row " << (int)row << ", col " << (int)col;
+            set_key(row, col, false);
+            EXPECT_EQ(settle(), pressed);
+        }
+    }
+}
+
+TEST_F(Matrix, ReadsKeysHeldTogether) {
+    for (uint16_t i = 0; i < 500; i++) {
+        for (uint8_t keys = next(8); keys > 0; keys--) {
+            set_key(next(MATRIX_ROWS), next(MATRIX_COLS), next(3) != 0);
+        }
+        EXPECT_EQ(settle(), pressed) << "pattern " << i;
+    }
+}
+
+#ifndef DIRECT_PINS
+/* Not a benchmark as such; counts the GPIO reads a scan takes, which is what bounds the scan rate on
+ * boards with wide matrices. */
+TEST_F(Matrix, ReadsEachInputPortOncePerStrobe) {
+    set_key(1, 3, true);
+    scan();
+    gpio_mock_pin_reads  = 0;
+    gpio_mock_port_reads = 0;
+    scan();
+
+    /* The unused column is neither read nor strobed. */
+    std::cout << MATRIX_ROWS << "x" << MATRIX_COLS << " matrix: " << gpio_mock_pin_reads << " pin reads and " << gpio_mock_port_reads << " port reads per scan" << std::endl;
+#ifdef MATRIX_PORT_READ
+    EXPECT_EQ(gpio_mock_pin_reads, 0);
+#    if (DIODE_DIRECTION == COL2ROW)
+    EXPECT_EQ(gpio_mock_port_reads, MATRIX_ROWS * MATRIX_INPUT_PORTS_COL2ROW);
+#    else
+    EXPECT_EQ(gpio_mock_port_reads, (MATRIX_COLS - 1) * MATRIX_INPUT_PORTS_ROW2COL);
+#    endif
+#else
+    EXPECT_EQ(gpio_mock_port_reads, 0);
+    EXPECT_EQ(gpio_mock_pin_reads, MATRIX_ROWS * (MATRIX_COLS - 1));
+#endif
+}
+#endif
+
+#ifdef MATRIX_SCAN_ON_CHANGE
+TEST_F(Matrix, IdlesOnceEverythingIsReleased) {
+    set_key(1, 5, true);
+    settle();
+    set_key(1, 5, false);
+    EXPECT_EQ(settle(), pressed);
+
+    uint32_t reads = gpio_reads();
+    for (uint16_t i = 0; i < 1000; i++) {
+        EXPECT_EQ(scan(), pressed);
+    }
+    EXPECT_EQ(gpio_reads(), reads);
+}
+
+TEST_F(Matrix, StaysAwakeUntilDebounceSettles) {
+    set_key(1, 5, true);
+    settle();
+    set_key(1, 5, false);
+    for (uint8_t i = 0; i < DEBOUNCE; i++) {
+        uint32_t reads = gpio_reads();
+        scan();
+        EXPECT_GT(gpio_reads(), reads) << "scan " << (int)i;
+        EXPECT_NE(matrix_get_row(1), 0);
+        wait_ms(1);
+    }
+    EXPECT_EQ(scan(), pressed);
+
+    uint32_t reads = gpio_reads();
+    scan();
+    EXPECT_EQ(gpio_reads(), reads);
+}
+
+TEST_F(Matrix, AnyKeyWakesAScan) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            settle();
+            uint32_t interrupts = gpio_mock_interrupts;
+            set_key(row, col, true);
+            bool connected = pressed[row] != 0;
+            EXPECT_EQ(gpio_mock_interrupts > interrupts, connected) << "row " << (int)row << ", col " << (int)col;
+            EXPECT_EQ(settle(), pressed);
+            set_key(row, col, false);
+        }
+    }
+}
+
+TEST_F(Matrix, WakesForAKeyPressedWhileGoingIdle) {
+    set_key(0, 0, true);
+    settle();
+    set_key(0, 0, false);
+
+    /* Pressed after the last scan read it, but before its interrupt is enabled. */
+    on_release = [&]() { set_key(1, 1, true); };
+    settle();
+    EXPECT_EQ(on_release, nullptr);
+    EXPECT_EQ(settle(), pressed);
+}
+#endif
@@ -0,0 +1,21 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 24
+
+/* Laid out the way real boards tend to be: a whole port in order, a port wired in reverse, the rest
+ * of the first port, an unused column and a stray pin. */
+#define MATRIX_ROW_PINS \
+    { TEST_PIN(0, 0), TEST_PIN(0, 1), TEST_PIN(0, 5), TEST_PIN(0, 4) }
+#define MATRIX_COL_PINS                                                                                                                                          \
+    {                                                                                                                                                            \
+        TEST_PIN(1, 0), TEST_PIN(1, 1), TEST_PIN(1, 2), TEST_PIN(1, 3), TEST_PIN(1, 4), TEST_PIN(1, 5), TEST_PIN(1, 6), TEST_PIN(1, 7),                          \
+        TEST_PIN(2, 15), TEST_PIN(2, 14), TEST_PIN(2, 13), TEST_PIN(2, 12), TEST_PIN(2, 11), TEST_PIN(2, 10), TEST_PIN(2, 9), TEST_PIN(2, 8),                    \
+        TEST_PIN(1, 8), TEST_PIN(1, 9), TEST_PIN(1, 10), TEST_PIN(1, 11), TEST_PIN(1, 12), TEST_PIN(1, 13), NO_PIN, TEST_PIN(3, 2)                               \
+    }
+
+#define MATRIX_INPUT_PORTS_COL2ROW 3
+#define MATRIX_INPUT_PORTS_ROW2COL 1
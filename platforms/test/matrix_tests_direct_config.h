@@ -0,0 +1,16 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 2
+#define MATRIX_COLS 10
+
+#define DIRECT_PINS                                                                                                                                                      \
+    {                                                                                                                                                                    \
+        {TEST_PIN(0, 0), TEST_PIN(0, 1), TEST_PIN(0, 2), TEST_PIN(0, 3), TEST_PIN(0, 4), TEST_PIN(1, 0), TEST_PIN(1, 1), NO_PIN, TEST_PIN(1, 3), TEST_PIN(1, 4)},        \
+        {TEST_PIN(2, 9), TEST_PIN(2, 8), TEST_PIN(2, 7), TEST_PIN(2, 6), TEST_PIN(2, 5), TEST_PIN(2, 4), TEST_PIN(2, 3), TEST_PIN(2, 2), TEST_PIN(2, 1), TEST_PIN(2, 0)} \
+    }
+
+/* The switches of a direct pin matrix close to ground, which this pin stands in for. */
+#define MATRIX_TEST_GROUND_PIN TEST_PIN(15, 0)
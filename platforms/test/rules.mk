@@ -23,3 +23,54 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+ws2812_spi_encoder_INC := \
+	$(PLATFORM_PATH)/chibios/drivers/
+ws2812_spi_encoder_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/ws2812_spi_encoder_tests.cpp
+
+eeprom_i2c_DEFS := -DEEPROM_I2C -DEEPROM_I2C_24LC64
+eeprom_i2c_INC := \
+	$(PLATFORM_PATH)/chibios/drivers/ \
+	$(TOP_DIR)/drivers/eeprom/
+eeprom_i2c_SRC := \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_i2c.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_i2c_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/i2c_master_mock.c
+
+matrix_col2row_DEFS := -DDIODE_DIRECTION=COL2ROW -DDEBOUNCE=0 -DIGNORE_ATOMIC_BLOCK -DNO_PRINT
+matrix_col2row_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_tests_config.h
+matrix_col2row_SRC := \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/matrix_common.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/gpio_mock.c
+
+matrix_col2row_port_read_DEFS := $(matrix_col2row_DEFS) -DMATRIX_PORT_READ
+matrix_col2row_port_read_CONFIG := $(matrix_col2row_CONFIG)
+matrix_col2row_port_read_SRC := $(matrix_col2row_SRC)
+
+matrix_row2col_port_read_DEFS := -DDIODE_DIRECTION=ROW2COL -DDEBOUNCE=0 -DIGNORE_ATOMIC_BLOCK -DNO_PRINT -DMATRIX_PORT_READ
+matrix_row2col_port_read_CONFIG := $(matrix_col2row_CONFIG)
+matrix_row2col_port_read_SRC := $(matrix_col2row_SRC)
+
+matrix_col2row_scan_on_change_DEFS := -DDIODE_DIRECTION=COL2ROW -DDEBOUNCE=5 -DIGNORE_ATOMIC_BLOCK -DNO_PRINT -DMATRIX_SCAN_ON_CHANGE
+matrix_col2row_scan_on_change_CONFIG := $(matrix_col2row_CONFIG)
+matrix_col2row_scan_on_change_SRC := \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/matrix_common.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_g.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/gpio_mock.c
+
+matrix_row2col_scan_on_change_DEFS := -DDIODE_DIRECTION=ROW2COL -DDEBOUNCE=5 -DIGNORE_ATOMIC_BLOCK -DNO_PRINT -DMATRIX_SCAN_ON_CHANGE -DMATRIX_PORT_READ
+matrix_row2col_scan_on_change_CONFIG := $(matrix_col2row_CONFIG)
+matrix_row2col_scan_on_change_SRC := $(matrix_col2row_scan_on_change_SRC)
+
+matrix_direct_scan_on_change_DEFS := -DDEBOUNCE=5 -DIGNORE_ATOMIC_BLOCK -DNO_PRINT -DMATRIX_SCAN_ON_CHANGE
+matrix_direct_scan_on_change_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/matrix_tests_direct_config.h
+matrix_direct_scan_on_change_SRC := $(matrix_col2row_scan_on_change_SRC)
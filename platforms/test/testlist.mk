@@ -1 +1,5 @@
 TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large
+TEST_LIST += ws2812_spi_encoder
+TEST_LIST += eeprom_i2c
+TEST_LIST += matrix_col2row matrix_col2row_port_read matrix_row2col_port_read
+TEST_LIST += matrix_col2row_scan_on_change matrix_row2col_scan_on_change matrix_direct_scan_on_change
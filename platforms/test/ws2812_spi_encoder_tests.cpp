@@ -0,0 +1,102 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ws2812_spi_encoder.h"
+}
+
+/* The bit by bit encoder the SPI driver used before the lookup table, kept as the reference. */
+static uint8_t get_protocol_eq(uint8_t data, int pos) {
+    uint8_t eq = 0;
+    if (data & (1 << (2 * (3 - pos))))
+        eq = 0b1110;
+    else
+        eq = 0b1000;
+    if (data & (2 << (2 * (3 - pos))))
+        eq += 0b11100000;
+    else
+        eq += 0b10000000;
+    return eq;
+}
+
+static void reference_encode_byte(uint8_t *out, uint8_t data) {
+    for (int j = 0; j < 4; j++) {
+        out[j] = get_protocol_eq(data, j);
+    }
+}
+
+class Ws2812SpiEncoder : public ::testing::Test {};
+
+TEST_F(Ws2812SpiEncoder, EveryByteMatchesReference) {
+    for (int data = 0; data < 256; data++) {
+        uint8_t expected[4];
+        uint8_t actual[4];
+        reference_encode_byte(expected, data);
+        ws2812_spi_encode_byte(actual, data);
+        for (int j = 0; j < 4; j++) {
+            EXPECT_EQ(actual[j], expected[j]) << "byte 0x" << std::hex << data << " position " << j;
+        }
+    }
+}
+
+TEST_F(Ws2812SpiEncoder, BitsAreSentMostSignificantFirst) {
+    uint8_t out[4];
+
+    ws2812_spi_encode_byte(out, 0x80);
+    EXPECT_EQ(out[0], 0b11101000);
+    EXPECT_EQ(out[1], 0b10001000);
+    EXPECT_EQ(out[2], 0b10001000);
+    EXPECT_EQ(out[3], 0b10001000);
+
+    ws2812_spi_encode_byte(out, 0x01);
+    EXPECT_EQ(out[0], 0b10001000);
+    EXPECT_EQ(out[1], 0b10001000);
+    EXPECT_EQ(out[2], 0b10001000);
+    EXPECT_EQ(out[3], 0b10001110);
+}
+
+TEST_F(Ws2812SpiEncoder, FrameBitstreamMatchesReference) {
+    const size_t         leds = 128, channels = 3;
+    std::vector<uint8_t> colours(leds * channels);
+    std::vector<uint8_t> expected(colours.size() * 4, 0);
+    std::vector<uint8_t> actual(colours.size() * 4, 0);
+
+    uint32_t seed = 0x12345678;
+    for (auto &colour : colours) {
+        seed   = seed * 1664525 + 1013904223;
+        colour = seed >> 24;
+    }
+
+    for (size_t i = 0; i < colours.size(); i++) {
+        reference_encode_byte(&expected[i * 4], colours[i]);
+        ws2812_spi_encode_byte(&actual[i * 4], colours[i]);
+    }
+    EXPECT_EQ(actual, expected);
+}
+
+/* Not a pass/fail benchmark, prints how long each encoder takes to expand a frame on the host. */
+TEST_F(Ws2812SpiEncoder, EncodeTimeReport) {
+    const size_t         bytes = 128 * 3, frames = 2000;
+    std::vector<uint8_t> out(bytes * 4);
+    volatile uint8_t     sink = 0;
+
+    auto time_us = [&](void (*encode)(uint8_t *, uint8_t)) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t frame = 0; frame < frames; frame++) {
+            for (size_t i = 0; i < bytes; i++) {
+                encode(&out[i * 4], (uint8_t)(i + frame));
+            }
+            sink = sink + out[frame % out.size()];
+        }
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+    };
+
+    double reference = time_us(reference_encode_byte);
+    double lut       = time_us(ws2812_spi_encode_byte);
+    std::cout << "Encoding " << bytes << " bytes: bit by bit " << reference << "us, lookup table " << lut << "us" << std::endl;
+}
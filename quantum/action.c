@@ -271,6 +271,13 @@ void process_record(keyrecord_t *record) {
         return;
     }
 
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC)
+    // Keys pressed while a string is being typed out are handled after it, so the host sees them in order
+    if (send_string_defer_record(record)) {
+        return;
+    }
+#endif
+
     if (!process_record_quantum(record)) {
 #ifndef NO_ACTION_ONESHOT
         if (is_oneshot_layer_active() && record->event.pressed && keymap_config.oneshot_enable) {
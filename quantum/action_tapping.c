@@ -29,7 +29,9 @@ uint16_t g_tapping_term = TAPPING_TERM;
 
 #    ifdef TAPPING_TERM_PER_KEY
 __attribute__((weak)) uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
-#        ifdef DYNAMIC_TAPPING_TERM_ENABLE
+#        if defined(ADAPTIVE_TAPPING_TERM_ENABLE)
+    return get_adaptive_tapping_term(keycode, record);
+#        elif defined(DYNAMIC_TAPPING_TERM_ENABLE)
     return g_tapping_term;
 #        else
     return TAPPING_TERM;
@@ -64,12 +66,25 @@ static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+_Static_assert(WAITING_BUFFER_SIZE <= 256, "WAITING_BUFFER_SIZE must be no more than 256");
+
+/* How many presses (low nibble) and releases (high nibble) of each matrix key are in waiting_buffer,
+ * so that looking for a key's events does not need to walk the buffer. */
+#    define WAITING_BUFFER_KEY_MASK(pressed) ((pressed) ? 0x0F : 0xF0)
+#    define WAITING_BUFFER_KEY_ONE(pressed) ((pressed) ? 0x01 : 0x10)
+static uint8_t waiting_buffer_keys[MATRIX_ROWS][MATRIX_COLS] = {};
+static uint8_t waiting_buffer_presses                         = 0;
+
 static bool process_tapping(keyrecord_t *record);
-static bool waiting_buffer_enq(keyrecord_t record);
-static void waiting_buffer_clear(void);
+static void waiting_buffer_enq(keyrecord_t record);
+static void waiting_buffer_deq(void);
+static void waiting_buffer_process(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
+#    ifdef CONCURRENT_TAPPING
+static void waiting_buffer_settle_tap(void);
+#    endif
 static void debug_tapping_key(void);
 static void debug_waiting_buffer(void);
 
@@ -85,28 +100,14 @@ void action_tapping_process(keyrecord_t record) {
             ac_dprintf("\n");
         }
     } else {
-        if (!waiting_buffer_enq(record)) {
-            // clear all in case of overflow.
-            ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
-            clear_keyboard();
-            waiting_buffer_clear();
-            tapping_key = (keyrecord_t){0};
-        }
+        waiting_buffer_enq(record);
     }
 
     // process waiting_buffer
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
-        if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
-            ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
-            debug_record(waiting_buffer[waiting_buffer_tail]);
-            ac_dprintf("\n\n");
-        } else {
-            break;
-        }
-    }
+    waiting_buffer_process();
     if (IS_EVENT(record.event)) {
         ac_dprintf("\n");
     }
@@ -171,7 +172,15 @@ bool process_tapping(keyrecord_t *keyp) {
     if (IS_NOEVENT(tapping_key.event)) {
         if (!IS_EVENT(event)) {
             // early return for tick events
-        } else if (event.pressed && is_tap_record(keyp)) {
+        }
+#    ifdef CONCURRENT_TAPPING
+        else if (waiting_buffer_tail != waiting_buffer_head && keyp != &waiting_buffer[waiting_buffer_tail]) {
+            // a new event goes behind those still draining from the buffer, so that no tap-hold
+            // key starts ahead of older events
+            return false;
+        }
+#    endif
+        else if (event.pressed && is_tap_record(keyp)) {
             // the currently pressed key is a tapping key, therefore transition
             // into the "pressed" tapping key state
             ac_dprintf("Tapping: Start(Press tap key).\n");
@@ -432,42 +441,106 @@ bool process_tapping(keyrecord_t *keyp) {
     }
 }
 
+/** \brief Waiting buffer key counts
+ *
+ * Returns the buffered press and release counts of a key, or NULL for keys outside the matrix.
+ */
+static uint8_t *waiting_buffer_key_counts(keypos_t key) {
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return NULL;
+    }
+    return &waiting_buffer_keys[key.row][key.col];
+}
+
+/** \brief Waiting buffer is full
+ *
+ * True when there is no room for the event, either in the ring or in its key's counts.
+ */
+static bool waiting_buffer_is_full(keyevent_t event) {
+    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+        return true;
+    }
+    uint8_t *counts = waiting_buffer_key_counts(event.key);
+    return counts && (*counts & WAITING_BUFFER_KEY_MASK(event.pressed)) == WAITING_BUFFER_KEY_MASK(event.pressed);
+}
+
 /** \brief Waiting buffer enq
  *
- * FIXME: Needs docs
+ * Events are never dropped. When the buffer is full, the tapping key is settled as a hold, which
+ * lets the buffered events through, before the event is added.
  */
-bool waiting_buffer_enq(keyrecord_t record) {
+void waiting_buffer_enq(keyrecord_t record) {
     if (IS_NOEVENT(record.event)) {
-        return true;
+        return;
     }
 
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
-        ac_dprintf("waiting_buffer_enq: Over flow.\n");
-        return false;
+    while (waiting_buffer_is_full(record.event)) {
+        ac_dprintf("waiting_buffer_enq: Full.\n");
+        if (IS_EVENT(tapping_key.event) && tapping_key.event.pressed && tapping_key.tap.count == 0) {
+            ac_dprintf("Tapping: End. No tap. Waiting buffer full\n");
+            process_record(&tapping_key);
+            tapping_key = (keyrecord_t){0};
+            debug_tapping_key();
+        }
+        waiting_buffer_process();
     }
 
     waiting_buffer[waiting_buffer_head] = record;
     waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
 
+    uint8_t *counts = waiting_buffer_key_counts(record.event.key);
+    if (counts) {
+        *counts += WAITING_BUFFER_KEY_ONE(record.event.pressed);
+    }
+    if (record.event.pressed) {
+        waiting_buffer_presses++;
+    }
+
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
-    return true;
 }
 
-/** \brief Waiting buffer clear
+/** \brief Waiting buffer deq
  *
- * FIXME: Needs docs
+ * Drops the oldest event, once it has been processed.
  */
-void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+static void waiting_buffer_deq(void) {
+    keyevent_t event  = waiting_buffer[waiting_buffer_tail].event;
+    uint8_t   *counts = waiting_buffer_key_counts(event.key);
+    if (counts) {
+        *counts -= WAITING_BUFFER_KEY_ONE(event.pressed);
+    }
+    if (event.pressed) {
+        waiting_buffer_presses--;
+    }
+    waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+}
+
+/** \brief Waiting buffer process
+ *
+ * Processes buffered events, oldest first, until the tapping state machine holds one back.
+ */
+static void waiting_buffer_process(void) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_deq()) {
+        if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
+            ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
+            debug_record(waiting_buffer[waiting_buffer_tail]);
+            ac_dprintf("\n\n");
+        } else {
+            break;
+        }
+    }
 }
 
 /** \brief Waiting buffer typed
  *
- * FIXME: Needs docs
+ * True when the buffer holds an event of the same key going the other way.
  */
 bool waiting_buffer_typed(keyevent_t event) {
+    uint8_t *counts = waiting_buffer_key_counts(event.key);
+    if (counts) {
+        return *counts & WAITING_BUFFER_KEY_MASK(!event.pressed);
+    }
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
@@ -481,10 +554,7 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
-    }
-    return false;
+    return waiting_buffer_presses > 0;
 }
 
 /** \brief Scan buffer for tapping
@@ -498,10 +568,18 @@ void waiting_buffer_scan_tap(void) {
     if ((tapping_key.tap.count > 0) || !tapping_key.event.pressed) {
         return;
     }
+#    ifdef CONCURRENT_TAPPING
+    waiting_buffer_settle_tap();
+#    else
+    // early return if the tapping key's release is not buffered
+    uint8_t *counts = waiting_buffer_key_counts(tapping_key.event.key);
+    if (counts && !(*counts & WAITING_BUFFER_KEY_MASK(false))) {
+        return;
+    }
 
-#    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
+#        if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
-#    endif
+#        endif
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
         keyrecord_t *candidate = &waiting_buffer[i];
         // clang-format off
@@ -518,7 +596,79 @@ void waiting_buffer_scan_tap(void) {
             return;
         }
     }
+#    endif
+}
+
+#    ifdef CONCURRENT_TAPPING
+/** \brief Waiting buffer pressed between
+ *
+ * True when the key was pressed in the buffer from first up to, but not including, last.
+ */
+static bool waiting_buffer_pressed_between(uint8_t first, uint8_t last, keypos_t key) {
+    for (uint8_t i = first; i != last; i = (i + 1) % WAITING_BUFFER_SIZE) {
+        if (waiting_buffer[i].event.pressed && KEYEQ(waiting_buffer[i].event.key, key)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** \brief Settle tapping key against the buffer
+ *
+ * A tap-hold key that was held up behind another one starts tapping with the events that followed
+ * its press already buffered. Replays them, in order, through the same rules process_tapping()
+ * applies to new events, so that it is settled as soon as they allow instead of waiting for more.
+ */
+static void waiting_buffer_settle_tap(void) {
+#        if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT)) || defined(PERMISSIVE_HOLD_PER_KEY) || defined(HOLD_ON_OTHER_KEY_PRESS_PER_KEY)
+    TAP_DEFINE_KEYCODE;
+#        endif
+    uint8_t first = waiting_buffer_tail;
+
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+        keyrecord_t *keyp  = &waiting_buffer[i];
+        keyevent_t   event = keyp->event;
+
+        // the tapping key's own press, when it was started from the buffer
+        if (event.pressed && IS_TAPPING_RECORD(keyp) && event.time == tapping_key.event.time) {
+            first = (i + 1) % WAITING_BUFFER_SIZE;
+            continue;
+        }
+
+        if (!WITHIN_TAPPING_TERM(event) && !MAYBE_RETRO_SHIFTING(event, keyp)) {
+            ac_dprintf("Tapping: End. Timeout. Not tap(0), buffered at [%u]\n", i);
+        } else if (IS_TAPPING_RECORD(keyp) && !event.pressed) {
+            ac_dprintf("Tapping: First tap(0->1), buffered at [%u]\n", i);
+            tapping_key.tap.count = 1;
+            keyp->tap             = tapping_key.tap;
+            process_record(&tapping_key);
+            debug_tapping_key();
+            return;
+        } else if (event.pressed) {
+            tapping_key.tap.interrupted = true;
+            // clang-format off
+            if (!TAP_GET_HOLD_ON_OTHER_KEY_PRESS
+#        if defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT)
+                || (MAYBE_RETRO_SHIFTING(event, keyp) && get_auto_shifted_key(get_record_keycode(keyp, false), keyp))
+#        endif
+            ) {
+                // clang-format on
+                continue;
+            }
+            ac_dprintf("Tapping: End. No tap. Interfered by pressed key, buffered at [%u]\n", i);
+        } else if (waiting_buffer_pressed_between(first, i, event.key) && (TAP_GET_PERMISSIVE_HOLD || TAP_GET_RETRO_TAPPING(keyp))) {
+            ac_dprintf("Tapping: End. No tap. Interfered by typing key, buffered at [%u]\n", i);
+        } else {
+            continue;
+        }
+
+        process_record(&tapping_key);
+        tapping_key = (keyrecord_t){0};
+        debug_tapping_key();
+        return;
+    }
 }
+#    endif
 
 /** \brief Tapping key debug print
  *
@@ -32,7 +32,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define TAPPING_TOGGLE 5
 #endif
 
-#define WAITING_BUFFER_SIZE 8
+/* number of key events held back while a tap-hold key is being settled */
+#ifndef WAITING_BUFFER_SIZE
+#    define WAITING_BUFFER_SIZE 16
+#endif
 
 #ifndef NO_ACTION_TAPPING
 uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache);
@@ -50,8 +53,14 @@ bool     get_hold_on_other_key_press(uint16_t keycode, keyrecord_t *record);
 extern uint16_t g_tapping_term;
 #endif
 
+#ifdef ADAPTIVE_TAPPING_TERM_ENABLE
+uint16_t get_adaptive_tapping_term(uint16_t keycode, keyrecord_t *record);
+#endif
+
 #if defined(TAPPING_TERM_PER_KEY) && !defined(NO_ACTION_TAPPING)
 #    define GET_TAPPING_TERM(keycode, record) get_tapping_term(keycode, record)
+#elif defined(ADAPTIVE_TAPPING_TERM_ENABLE) && !defined(NO_ACTION_TAPPING)
+#    define GET_TAPPING_TERM(keycode, record) get_adaptive_tapping_term(keycode, record)
 #elif defined(DYNAMIC_TAPPING_TERM_ENABLE) && !defined(NO_ACTION_TAPPING)
 #    define GET_TAPPING_TERM(keycode, record) g_tapping_term
 #else
@@ -14,6 +14,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
@@ -101,30 +102,111 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#define DYNAMIC_KEYMAP_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+// Number of bytes from offset up to size that fall inside a buffer of the given length.
+static inline uint16_t dynamic_keymap_buffer_length(uint16_t offset, uint16_t size, uint16_t length) {
+    if (offset >= length) {
+        return 0;
+    }
+    return (length - offset) < size ? (length - offset) : size;
+}
+
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+// Copy of the keymaps in EEPROM, byte for byte, so lookups on the key event path
+// do not go to the EEPROM. Loaded once, then written through on every change.
+static uint8_t dynamic_keymap_mirror[DYNAMIC_KEYMAP_EEPROM_SIZE];
+static bool    dynamic_keymap_mirror_loaded = false;
+
+static void dynamic_keymap_mirror_load(void) {
+    eeprom_read_block(dynamic_keymap_mirror, (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_EEPROM_SIZE);
+    dynamic_keymap_mirror_loaded = true;
+}
+
+static inline uint8_t *dynamic_keymap_mirror_get(void) {
+    if (!dynamic_keymap_mirror_loaded) {
+        dynamic_keymap_mirror_load();
+    }
+    return dynamic_keymap_mirror;
+}
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
+#if DYNAMIC_KEYMAP_MACRO_COUNT > 0
+// Offsets of the start of each macro in the macro buffer, so playback does not have to
+// count NULs from the start of the buffer. Only the first dynamic_keymap_macro_indexed
+// entries are known, the rest are found on demand and forgotten again when the part of
+// the buffer they depend on is written.
+static uint16_t dynamic_keymap_macro_offsets[DYNAMIC_KEYMAP_MACRO_COUNT] = {0};
+static uint8_t  dynamic_keymap_macro_indexed                             = 1;
+
+static void dynamic_keymap_macro_index_invalidate(uint16_t offset) {
+    // A macro's start only depends on the bytes before it
+    while (dynamic_keymap_macro_indexed > 1 && dynamic_keymap_macro_offsets[dynamic_keymap_macro_indexed - 1] > offset) {
+        --dynamic_keymap_macro_indexed;
+    }
+}
+
+static bool dynamic_keymap_macro_index_find(uint8_t id) {
+    uint8_t  chunk[32];
+    uint16_t offset = dynamic_keymap_macro_offsets[dynamic_keymap_macro_indexed - 1];
+    while (dynamic_keymap_macro_indexed <= id) {
+        // If we are past the end of the buffer, then there is
+        // no Nth macro in the buffer.
+        if (offset >= DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
+            return false;
+        }
+        uint16_t length = dynamic_keymap_buffer_length(offset, sizeof(chunk), DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+        eeprom_read_block(chunk, ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset, length);
+        for (uint16_t i = 0; i < length && dynamic_keymap_macro_indexed <= id; i++) {
+            if (chunk[i] == 0) {
+                dynamic_keymap_macro_offsets[dynamic_keymap_macro_indexed++] = offset + i + 1;
+            }
+        }
+        offset += length;
+    }
+    return true;
+}
+#endif // DYNAMIC_KEYMAP_MACRO_COUNT > 0
+
+void dynamic_keymap_init(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_load();
+#endif
+#if DYNAMIC_KEYMAP_MACRO_COUNT > 0
+    dynamic_keymap_macro_indexed = 1;
+#endif
+}
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
-void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column) {
+static inline uint16_t dynamic_keymap_key_to_offset(uint8_t layer, uint8_t row, uint8_t column) {
     // TODO: optimize this with some left shifts
-    return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    return (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+}
+
+void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column) {
+    return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + dynamic_keymap_key_to_offset(layer, row, column);
 }
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
-    void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    const uint8_t *data = dynamic_keymap_mirror_get() + dynamic_keymap_key_to_offset(layer, row, column);
+#else
+    uint8_t data[2];
+    eeprom_read_block(data, dynamic_keymap_key_to_eeprom_address(layer, row, column), sizeof(data));
+#endif
     // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = eeprom_read_byte(address) << 8;
-    keycode |= eeprom_read_byte(address + 1);
-    return keycode;
+    return (data[0] << 8) | data[1];
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
-    void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    uint8_t data[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    dynamic_keymap_set_buffer(dynamic_keymap_key_to_offset(layer, row, column), sizeof(data), data);
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -134,29 +216,33 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
-    void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
+    void *  address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
+    uint8_t data[2];
+    eeprom_read_block(data, address + (clockwise ? 0 : 2), sizeof(data));
     // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
-    keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
-    return keycode;
+    return (data[0] << 8) | data[1];
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+    uint8_t data[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    eeprom_update_block(data, address + (clockwise ? 0 : 2), sizeof(data));
 }
 #endif // ENCODER_MAP_ENABLE
 
 void dynamic_keymap_reset(void) {
-    // Reset the keymaps in EEPROM to what is in flash.
+    // Reset the keymaps in EEPROM to what is in flash, a row at a time.
+    uint8_t data[MATRIX_COLS * 2];
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
             for (int column = 0; column < MATRIX_COLS; column++) {
-                dynamic_keymap_set_keycode(layer, row, column, keycode_at_keymap_location_raw(layer, row, column));
+                uint16_t keycode     = keycode_at_keymap_location_raw(layer, row, column);
+                data[column * 2]     = (uint8_t)(keycode >> 8);
+                data[column * 2 + 1] = (uint8_t)(keycode & 0xFF);
             }
+            dynamic_keymap_set_buffer(dynamic_keymap_key_to_offset(layer, row, 0), sizeof(data), data);
         }
 #ifdef ENCODER_MAP_ENABLE
         for (int encoder = 0; encoder < NUM_ENCODERS; encoder++) {
@@ -168,31 +254,21 @@ void dynamic_keymap_reset(void) {
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
-    }
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_EEPROM_SIZE);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    memcpy(data, dynamic_keymap_mirror_get() + offset, length);
+#else
+    eeprom_read_block(data, ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + offset, length);
+#endif
+    memset(data + length, 0x00, size - length);
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_EEPROM_SIZE);
+    eeprom_update_block(data, ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + offset, length);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    memcpy(dynamic_keymap_mirror_get() + offset, data, length);
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,37 +296,23 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
-    }
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    eeprom_read_block(data, ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset, length);
+    memset(data + length, 0x00, size - length);
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    uint16_t length = dynamic_keymap_buffer_length(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    eeprom_update_block(data, ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset, length);
+#if DYNAMIC_KEYMAP_MACRO_COUNT > 0
+    dynamic_keymap_macro_index_invalidate(offset);
+#endif
 }
 
 void dynamic_keymap_macro_reset(void) {
-    void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (p != end) {
-        eeprom_update_byte(p, 0);
-        ++p;
+    uint8_t zeros[32] = {0};
+    for (uint32_t offset = 0; offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE; offset += sizeof(zeros)) {
+        dynamic_keymap_macro_set_buffer(offset, sizeof(zeros), zeros);
     }
 }
 
@@ -268,21 +330,18 @@ void dynamic_keymap_macro_send(uint8_t id) {
         return;
     }
 
-    // Skip N null characters
-    // p will then point to the Nth macro
-    p         = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (id > 0) {
-        // If we are past the end of the buffer, then there is
-        // no Nth macro in the buffer.
-        if (p == end) {
-            return;
-        }
-        if (eeprom_read_byte(p) == 0) {
-            --id;
-        }
-        ++p;
+#if DYNAMIC_KEYMAP_MACRO_COUNT > 0
+    // Look up where the Nth macro starts, finding it first
+    // if it has not been looked up since the buffer changed
+    if (id >= dynamic_keymap_macro_indexed && !dynamic_keymap_macro_index_find(id)) {
+        return;
     }
+    // The last NUL of a full buffer does not start another macro
+    if (dynamic_keymap_macro_offsets[id] >= DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
+        return;
+    }
+    p = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + dynamic_keymap_macro_offsets[id];
+#endif
 
     // Send the macro string by making a temporary string.
     char data[8] = {0};
@@ -18,6 +18,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// Loads the RAM copy of the keymaps when DYNAMIC_KEYMAP_RAM_MIRROR is defined,
+// and forgets where macros start so they are looked up again
+void     dynamic_keymap_init(void);
 uint8_t  dynamic_keymap_get_layer_count(void);
 void *   dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column);
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
@@ -20,6 +20,140 @@ void eeconfig_init_via(void);
 
 _Static_assert((intptr_t)EECONFIG_HANDEDNESS == 14, "EEPROM handedness offset is incorrect");
 
+#if defined(EECONFIG_WRITE_BACK_CACHE)
+#    include "timer.h"
+
+#    ifndef EECONFIG_FLUSH_DELAY
+#        define EECONFIG_FLUSH_DELAY 1000
+#    endif
+
+typedef struct {
+    uint16_t offset;
+    uint16_t size;
+} eeconfig_region_t;
+
+#    define EECONFIG_REGION(member) {offsetof(eeprom_core_t, member), sizeof(((eeprom_core_t *)0)->member)}
+
+// Each region is written back on its own, so a change to one feature's settings only touches its own bytes
+static const eeconfig_region_t eeconfig_regions[] = {
+    EECONFIG_REGION(magic),
+    EECONFIG_REGION(debug),
+    EECONFIG_REGION(default_layer),
+    EECONFIG_REGION(keymap),
+    EECONFIG_REGION(backlight),
+    EECONFIG_REGION(audio),
+    EECONFIG_REGION(rgblight),
+    EECONFIG_REGION(unicode),
+    EECONFIG_REGION(steno),
+    EECONFIG_REGION(handedness),
+    EECONFIG_REGION(keyboard),
+    EECONFIG_REGION(user),
+    EECONFIG_REGION(rgb_matrix),
+    EECONFIG_REGION(haptic),
+    EECONFIG_REGION(rgblight_ext),
+#    if (EECONFIG_KB_DATA_SIZE) > 0
+    {(uintptr_t)EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE)},
+#    endif
+#    if (EECONFIG_USER_DATA_SIZE) > 0
+    {(uintptr_t)EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE)},
+#    endif
+};
+
+_Static_assert(ARRAY_SIZE(eeconfig_regions) <= 32, "Too many eeconfig regions for the dirty mask");
+
+static uint8_t  eeconfig_cache[EECONFIG_SIZE];
+static bool     eeconfig_cache_valid = false;
+static uint32_t eeconfig_cache_dirty = 0;
+static uint32_t eeconfig_cache_dirty_time;
+
+static void eeconfig_cache_load(void) {
+    if (!eeconfig_cache_valid) {
+        eeprom_read_block(eeconfig_cache, (const void *)0, sizeof(eeconfig_cache));
+        eeconfig_cache_valid = true;
+    }
+}
+
+/** \brief Drops the RAM copy, used when the EEPROM has been changed underneath the cache
+ */
+static inline void eeconfig_cache_invalidate(void) {
+    eeconfig_cache_valid = false;
+    eeconfig_cache_dirty = 0;
+}
+
+/** \brief eeconfig read block
+ *
+ * Reads from the RAM copy of the eeconfig area, anything past the end is read from EEPROM.
+ */
+void eeconfig_read_block(void *data, const void *offset, size_t size) {
+    uintptr_t addr = (uintptr_t)offset;
+    if (addr < sizeof(eeconfig_cache)) {
+        size_t cached = MIN(size, sizeof(eeconfig_cache) - addr);
+        eeconfig_cache_load();
+        memcpy(data, &eeconfig_cache[addr], cached);
+        data = (uint8_t *)data + cached;
+        addr += cached;
+        size -= cached;
+    }
+    if (size > 0) {
+        eeprom_read_block(data, (const void *)addr, size);
+    }
+}
+
+/** \brief eeconfig update block
+ *
+ * Updates the RAM copy of the eeconfig area and marks the regions touched as dirty, anything past the end is
+ * written to EEPROM immediately.
+ */
+void eeconfig_update_block(const void *data, void *offset, size_t size) {
+    uintptr_t addr = (uintptr_t)offset;
+    if (addr < sizeof(eeconfig_cache)) {
+        size_t cached = MIN(size, sizeof(eeconfig_cache) - addr);
+        eeconfig_cache_load();
+        if (memcmp(&eeconfig_cache[addr], data, cached) != 0) {
+            memcpy(&eeconfig_cache[addr], data, cached);
+            if (!eeconfig_cache_dirty) {
+                eeconfig_cache_dirty_time = timer_read32();
+            }
+            for (uint8_t i = 0; i < ARRAY_SIZE(eeconfig_regions); i++) {
+                if (eeconfig_regions[i].offset < addr + cached && addr < eeconfig_regions[i].offset + eeconfig_regions[i].size) {
+                    eeconfig_cache_dirty |= (uint32_t)1 << i;
+                }
+            }
+        }
+        data = (const uint8_t *)data + cached;
+        addr += cached;
+        size -= cached;
+    }
+    if (size > 0) {
+        eeprom_update_block(data, (void *)addr, size);
+    }
+}
+
+/** \brief eeconfig flush
+ *
+ * Writes every dirty region back to EEPROM.
+ */
+void eeconfig_flush(void) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(eeconfig_regions) && eeconfig_cache_dirty; i++) {
+        if (eeconfig_cache_dirty & ((uint32_t)1 << i)) {
+            eeprom_update_block(&eeconfig_cache[eeconfig_regions[i].offset], (void *)(uintptr_t)eeconfig_regions[i].offset, eeconfig_regions[i].size);
+            eeconfig_cache_dirty &= ~((uint32_t)1 << i);
+        }
+    }
+}
+
+/** \brief eeconfig task
+ *
+ * Flushes once EECONFIG_FLUSH_DELAY has passed since the oldest unwritten change, so a burst of updates becomes a
+ * single write per region.
+ */
+void eeconfig_task(void) {
+    if (eeconfig_cache_dirty && timer_elapsed32(eeconfig_cache_dirty_time) >= (EECONFIG_FLUSH_DELAY)) {
+        eeconfig_flush();
+    }
+}
+#endif // EECONFIG_WRITE_BACK_CACHE
+
 /** \brief eeconfig enable
  *
  * FIXME: needs doc
@@ -46,22 +180,25 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
 void eeconfig_init_quantum(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_format(false);
+#    if defined(EECONFIG_WRITE_BACK_CACHE)
+    eeconfig_cache_invalidate();
+#    endif
 #endif
 
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
-    eeprom_update_byte(EECONFIG_DEBUG, 0);
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+    eeconfig_update_byte(EECONFIG_DEBUG, 0);
     default_layer_state = (layer_state_t)1 << 0;
     eeconfig_update_default_layer(default_layer_state);
     // Enable oneshot and autocorrect by default: 0b0001 0100 0000 0000
-    eeprom_update_word(EECONFIG_KEYMAP, 0x1400);
-    eeprom_update_byte(EECONFIG_BACKLIGHT, 0);
-    eeprom_update_byte(EECONFIG_AUDIO, 0);
-    eeprom_update_dword(EECONFIG_RGBLIGHT, 0);
-    eeprom_update_byte(EECONFIG_RGBLIGHT_EXTENDED, 0);
-    eeprom_update_byte(EECONFIG_UNICODEMODE, 0);
-    eeprom_update_byte(EECONFIG_STENOMODE, 0);
-    eeprom_write_qword(EECONFIG_RGB_MATRIX, 0);
-    eeprom_update_dword(EECONFIG_HAPTIC, 0);
+    eeconfig_update_word(EECONFIG_KEYMAP, 0x1400);
+    eeconfig_update_byte(EECONFIG_BACKLIGHT, 0);
+    eeconfig_update_byte(EECONFIG_AUDIO, 0);
+    eeconfig_update_dword(EECONFIG_RGBLIGHT, 0);
+    eeconfig_update_byte(EECONFIG_RGBLIGHT_EXTENDED, 0);
+    eeconfig_update_byte(EECONFIG_UNICODEMODE, 0);
+    eeconfig_update_byte(EECONFIG_STENOMODE, 0);
+    eeconfig_update_block(&(uint64_t){0}, EECONFIG_RGB_MATRIX, sizeof(uint64_t));
+    eeconfig_update_dword(EECONFIG_HAPTIC, 0);
 #if defined(HAPTIC_ENABLE)
     haptic_reset();
 #endif
@@ -83,6 +220,7 @@ void eeconfig_init_quantum(void) {
 #endif
 
     eeconfig_init_kb();
+    eeconfig_flush();
 }
 
 /** \brief eeconfig initialization
@@ -98,7 +236,7 @@ void eeconfig_init(void) {
  * FIXME: needs doc
  */
 void eeconfig_enable(void) {
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
 }
 
 /** \brief eeconfig disable
@@ -108,8 +246,12 @@ void eeconfig_enable(void) {
 void eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_format(false);
+#    if defined(EECONFIG_WRITE_BACK_CACHE)
+    eeconfig_cache_invalidate();
+#    endif
 #endif
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
+    eeconfig_flush();
 }
 
 /** \brief eeconfig is enabled
@@ -117,7 +259,7 @@ void eeconfig_disable(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_enabled(void) {
-    bool is_eeprom_enabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
+    bool is_eeprom_enabled = (eeconfig_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
 #ifdef VIA_ENABLE
     if (is_eeprom_enabled) {
         is_eeprom_enabled = via_eeprom_is_valid();
@@ -131,7 +273,7 @@ bool eeconfig_is_enabled(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_disabled(void) {
-    bool is_eeprom_disabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
+    bool is_eeprom_disabled = (eeconfig_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
 #ifdef VIA_ENABLE
     if (!is_eeprom_disabled) {
         is_eeprom_disabled = !via_eeprom_is_valid();
@@ -145,14 +287,14 @@ bool eeconfig_is_disabled(void) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_debug(void) {
-    return eeprom_read_byte(EECONFIG_DEBUG);
+    return eeconfig_read_byte(EECONFIG_DEBUG);
 }
 /** \brief eeconfig update debug
  *
  * FIXME: needs doc
  */
 void eeconfig_update_debug(uint8_t val) {
-    eeprom_update_byte(EECONFIG_DEBUG, val);
+    eeconfig_update_byte(EECONFIG_DEBUG, val);
 }
 
 /** \brief eeconfig read default layer
@@ -160,7 +302,7 @@ void eeconfig_update_debug(uint8_t val) {
  * FIXME: needs doc
  */
 layer_state_t eeconfig_read_default_layer(void) {
-    uint8_t val = eeprom_read_byte(EECONFIG_DEFAULT_LAYER);
+    uint8_t val = eeconfig_read_byte(EECONFIG_DEFAULT_LAYER);
 
 #ifdef DEFAULT_LAYER_STATE_IS_VALUE_NOT_BITMASK
     // stored as a layer number, so convert back to bitmask
@@ -183,7 +325,7 @@ void eeconfig_update_default_layer(layer_state_t state) {
     uint8_t val = state;
 #endif
 
-    eeprom_update_byte(EECONFIG_DEFAULT_LAYER, val);
+    eeconfig_update_byte(EECONFIG_DEFAULT_LAYER, val);
 }
 
 /** \brief eeconfig read keymap
@@ -191,14 +333,14 @@ void eeconfig_update_default_layer(layer_state_t state) {
  * FIXME: needs doc
  */
 uint16_t eeconfig_read_keymap(void) {
-    return eeprom_read_word(EECONFIG_KEYMAP);
+    return eeconfig_read_word(EECONFIG_KEYMAP);
 }
 /** \brief eeconfig update keymap
  *
  * FIXME: needs doc
  */
 void eeconfig_update_keymap(uint16_t val) {
-    eeprom_update_word(EECONFIG_KEYMAP, val);
+    eeconfig_update_word(EECONFIG_KEYMAP, val);
 }
 
 /** \brief eeconfig read audio
@@ -206,14 +348,14 @@ void eeconfig_update_keymap(uint16_t val) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_audio(void) {
-    return eeprom_read_byte(EECONFIG_AUDIO);
+    return eeconfig_read_byte(EECONFIG_AUDIO);
 }
 /** \brief eeconfig update audio
  *
  * FIXME: needs doc
  */
 void eeconfig_update_audio(uint8_t val) {
-    eeprom_update_byte(EECONFIG_AUDIO, val);
+    eeconfig_update_byte(EECONFIG_AUDIO, val);
 }
 
 #if (EECONFIG_KB_DATA_SIZE) == 0
@@ -222,14 +364,14 @@ void eeconfig_update_audio(uint8_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_kb(void) {
-    return eeprom_read_dword(EECONFIG_KEYBOARD);
+    return eeconfig_read_dword(EECONFIG_KEYBOARD);
 }
 /** \brief eeconfig update kb
  *
  * FIXME: needs doc
  */
 void eeconfig_update_kb(uint32_t val) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, val);
+    eeconfig_update_dword(EECONFIG_KEYBOARD, val);
 }
 #endif // (EECONFIG_KB_DATA_SIZE) == 0
 
@@ -239,14 +381,14 @@ void eeconfig_update_kb(uint32_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_user(void) {
-    return eeprom_read_dword(EECONFIG_USER);
+    return eeconfig_read_dword(EECONFIG_USER);
 }
 /** \brief eeconfig update user
  *
  * FIXME: needs doc
  */
 void eeconfig_update_user(uint32_t val) {
-    eeprom_update_dword(EECONFIG_USER, val);
+    eeconfig_update_dword(EECONFIG_USER, val);
 }
 #endif // (EECONFIG_USER_DATA_SIZE) == 0
 
@@ -255,14 +397,14 @@ void eeconfig_update_user(uint32_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_haptic(void) {
-    return eeprom_read_dword(EECONFIG_HAPTIC);
+    return eeconfig_read_dword(EECONFIG_HAPTIC);
 }
 /** \brief eeconfig update haptic
  *
  * FIXME: needs doc
  */
 void eeconfig_update_haptic(uint32_t val) {
-    eeprom_update_dword(EECONFIG_HAPTIC, val);
+    eeconfig_update_dword(EECONFIG_HAPTIC, val);
 }
 
 /** \brief eeconfig read split handedness
@@ -270,14 +412,14 @@ void eeconfig_update_haptic(uint32_t val) {
  * FIXME: needs doc
  */
 bool eeconfig_read_handedness(void) {
-    return !!eeprom_read_byte(EECONFIG_HANDEDNESS);
+    return !!eeconfig_read_byte(EECONFIG_HANDEDNESS);
 }
 /** \brief eeconfig update split handedness
  *
  * FIXME: needs doc
  */
 void eeconfig_update_handedness(bool val) {
-    eeprom_update_byte(EECONFIG_HANDEDNESS, !!val);
+    eeconfig_update_byte(EECONFIG_HANDEDNESS, !!val);
 }
 
 #if (EECONFIG_KB_DATA_SIZE) > 0
@@ -286,7 +428,7 @@ void eeconfig_update_handedness(bool val) {
  * FIXME: needs doc
  */
 bool eeconfig_is_kb_datablock_valid(void) {
-    return eeprom_read_dword(EECONFIG_KEYBOARD) == (EECONFIG_KB_DATA_VERSION);
+    return eeconfig_read_dword(EECONFIG_KEYBOARD) == (EECONFIG_KB_DATA_VERSION);
 }
 /** \brief eeconfig read keyboard data block
  *
@@ -294,7 +436,7 @@ bool eeconfig_is_kb_datablock_valid(void) {
  */
 void eeconfig_read_kb_datablock(void *data) {
     if (eeconfig_is_kb_datablock_valid()) {
-        eeprom_read_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
+        eeconfig_read_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
     } else {
         memset(data, 0, (EECONFIG_KB_DATA_SIZE));
     }
@@ -304,8 +446,8 @@ void eeconfig_read_kb_datablock(void *data) {
  * FIXME: needs doc
  */
 void eeconfig_update_kb_datablock(const void *data) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
-    eeprom_update_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
+    eeconfig_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
+    eeconfig_update_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
 }
 /** \brief eeconfig init keyboard data block
  *
@@ -323,7 +465,7 @@ __attribute__((weak)) void eeconfig_init_kb_datablock(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_user_datablock_valid(void) {
-    return eeprom_read_dword(EECONFIG_USER) == (EECONFIG_USER_DATA_VERSION);
+    return eeconfig_read_dword(EECONFIG_USER) == (EECONFIG_USER_DATA_VERSION);
 }
 /** \brief eeconfig read user data block
  *
@@ -331,7 +473,7 @@ bool eeconfig_is_user_datablock_valid(void) {
  */
 void eeconfig_read_user_datablock(void *data) {
     if (eeconfig_is_user_datablock_valid()) {
-        eeprom_read_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
+        eeconfig_read_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
     } else {
         memset(data, 0, (EECONFIG_USER_DATA_SIZE));
     }
@@ -341,8 +483,8 @@ void eeconfig_read_user_datablock(void *data) {
  * FIXME: needs doc
  */
 void eeconfig_update_user_datablock(const void *data) {
-    eeprom_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
-    eeprom_update_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
+    eeconfig_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
+    eeconfig_update_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
 }
 /** \brief eeconfig init user data block
  *
@@ -166,6 +166,52 @@ void eeconfig_update_user_datablock(const void *data);
 void eeconfig_init_user_datablock(void);
 #endif // (EECONFIG_USER_DATA_SIZE) > 0
 
+#ifdef EECONFIG_WRITE_BACK_CACHE
+// Reads and updates of the eeconfig area go through a RAM copy, with changes
+// written back per region once EECONFIG_FLUSH_DELAY has elapsed, on suspend,
+// or before a reset/bootloader jump.
+void eeconfig_read_block(void *data, const void *offset, size_t size);
+void eeconfig_update_block(const void *data, void *offset, size_t size);
+void eeconfig_flush(void);
+void eeconfig_task(void);
+
+static inline uint8_t eeconfig_read_byte(const uint8_t *offset) {
+    uint8_t val;
+    eeconfig_read_block(&val, offset, sizeof(val));
+    return val;
+}
+static inline uint16_t eeconfig_read_word(const uint16_t *offset) {
+    uint16_t val;
+    eeconfig_read_block(&val, offset, sizeof(val));
+    return val;
+}
+static inline uint32_t eeconfig_read_dword(const uint32_t *offset) {
+    uint32_t val;
+    eeconfig_read_block(&val, offset, sizeof(val));
+    return val;
+}
+static inline void eeconfig_update_byte(uint8_t *offset, uint8_t val) {
+    eeconfig_update_block(&val, offset, sizeof(val));
+}
+static inline void eeconfig_update_word(uint16_t *offset, uint16_t val) {
+    eeconfig_update_block(&val, offset, sizeof(val));
+}
+static inline void eeconfig_update_dword(uint32_t *offset, uint32_t val) {
+    eeconfig_update_block(&val, offset, sizeof(val));
+}
+#else
+#    define eeconfig_read_block eeprom_read_block
+#    define eeconfig_update_block eeprom_update_block
+#    define eeconfig_read_byte eeprom_read_byte
+#    define eeconfig_read_word eeprom_read_word
+#    define eeconfig_read_dword eeprom_read_dword
+#    define eeconfig_update_byte eeprom_update_byte
+#    define eeconfig_update_word eeprom_update_word
+#    define eeconfig_update_dword eeprom_update_dword
+static inline void eeconfig_flush(void) {}
+static inline void eeconfig_task(void) {}
+#endif // EECONFIG_WRITE_BACK_CACHE
+
 // Any "checked" debounce variant used requires implementation of:
 //    -- bool eeconfig_check_valid_##name(void)
 //    -- void eeconfig_post_flush_##name(void)
@@ -178,13 +224,13 @@ void eeconfig_init_user_datablock(void);
     static inline void eeconfig_init_##name(void) {                     \
         dirty_##name = true;                                            \
         if (eeconfig_check_valid_##name()) {                            \
-            eeprom_read_block(&config, offset, sizeof(config));         \
+            eeconfig_read_block(&config, offset, sizeof(config));       \
             dirty_##name = false;                                       \
         }                                                               \
     }                                                                   \
     static inline void eeconfig_flush_##name(bool force) {              \
         if (force || dirty_##name) {                                    \
-            eeprom_update_block(&config, offset, sizeof(config));       \
+            eeconfig_update_block(&config, offset, sizeof(config));     \
             eeconfig_post_flush_##name();                               \
             dirty_##name = false;                                       \
         }                                                               \
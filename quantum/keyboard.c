@@ -101,6 +101,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef ST7565_ENABLE
 #    include "st7565.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
@@ -143,6 +146,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC)
+#    include "send_string.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -422,6 +428,12 @@ void keyboard_init(void) {
 #endif
     matrix_init();
     quantum_init();
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_init();
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    key_override_init();
+#endif
     led_init_ports();
 #ifdef BACKLIGHT_ENABLE
     backlight_init_ports();
@@ -662,6 +674,14 @@ void quantum_task(void) {
 #ifdef LAYER_LOCK_ENABLE
     layer_lock_task();
 #endif
+
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC)
+    send_string_task();
+#endif
+
+#if defined(UNICODE_COMMON_ENABLE) && defined(UNICODE_ASYNC)
+    unicode_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
@@ -755,4 +775,16 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#if defined(VIA_ENABLE) && defined(VIA_BULK_TRANSFER_ENABLE)
+    via_task();
+#endif
+
+#ifdef EECONFIG_WRITE_BACK_CACHE
+    eeconfig_task();
+#endif
+
+#ifdef EEPROM_DRIVER
+    eeprom_driver_task();
+#endif
 }
@@ -170,4 +170,25 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+#    ifdef KEY_OVERRIDE_INDEX_ENABLE
+// Sized here, where the number of key overrides is known at compile time. Positions are stored in a byte each.
+#        ifdef KEY_OVERRIDE_INDEX_SIZE
+#            define KEY_OVERRIDE_INDEX_SIZE_RAW KEY_OVERRIDE_INDEX_SIZE
+#        else
+#            define KEY_OVERRIDE_INDEX_SIZE_RAW MIN(ARRAY_SIZE(key_overrides), 256)
+#        endif
+
+_Static_assert(KEY_OVERRIDE_INDEX_SIZE_RAW <= 256, "KEY_OVERRIDE_INDEX_SIZE must not be greater than 256");
+
+static uint8_t key_override_index_storage[KEY_OVERRIDE_INDEX_SIZE_RAW];
+
+uint16_t key_override_index_size(void) {
+    return KEY_OVERRIDE_INDEX_SIZE_RAW;
+}
+
+uint8_t* key_override_index_buffer(void) {
+    return key_override_index_storage;
+}
+#    endif // KEY_OVERRIDE_INDEX_ENABLE
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
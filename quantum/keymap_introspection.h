@@ -108,4 +108,9 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 // Get the key override definitions, potentially stored dynamically
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
+// Get the number of key overrides that can be indexed by trigger keycode, the number defined in the user's keymap unless KEY_OVERRIDE_INDEX_SIZE is set
+uint16_t key_override_index_size(void);
+// Get the buffer key overrides are indexed in, key_override_index_size() entries long
+uint8_t* key_override_index_buffer(void);
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
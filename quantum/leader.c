@@ -4,9 +4,15 @@
 #include "leader.h"
 #include "timer.h"
 #include "util.h"
+#include "progmem.h"
 
 #include <string.h>
 
+#if __has_include("leader_data.h")
+#    include "quantum.h"
+#    include "leader_data.h"
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
@@ -21,6 +27,35 @@ __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
 
+#ifdef LEADER_TABLE_SIZE
+#    define LEADER_TABLE_NONE 0xFFFF
+
+// Current node of the trie in leader_table, or LEADER_TABLE_NONE once the sequence left it.
+static uint16_t leader_table_node = LEADER_TABLE_NONE;
+
+__attribute__((weak)) bool leader_action_user(uint16_t action) {
+    return true;
+}
+
+/**
+ * \brief Follows the child of `node` for `keycode`.
+ *
+ * A node is its number of children, then its action, then a keycode and node index for each child.
+ */
+static uint16_t leader_table_next(uint16_t node, uint16_t keycode) {
+    if (node == LEADER_TABLE_NONE) {
+        return LEADER_TABLE_NONE;
+    }
+    uint16_t children = pgm_read_word(&leader_table[node]);
+    for (uint16_t i = node + 2; i < node + 2 + 2 * children; i += 2) {
+        if (pgm_read_word(&leader_table[i]) == keycode) {
+            return pgm_read_word(&leader_table[i + 1]);
+        }
+    }
+    return LEADER_TABLE_NONE;
+}
+#endif
+
 void leader_start(void) {
     if (leading) {
         return;
@@ -30,10 +65,20 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#ifdef LEADER_TABLE_SIZE
+    leader_table_node = 0;
+#endif
 }
 
 void leader_end(void) {
     leading = false;
+#ifdef LEADER_TABLE_SIZE
+    uint16_t action   = leader_table_node == LEADER_TABLE_NONE ? KC_NO : pgm_read_word(&leader_table[leader_table_node + 1]);
+    leader_table_node = LEADER_TABLE_NONE;
+    if (action != KC_NO && leader_action_user(action)) {
+        tap_code16(action);
+    }
+#endif
     leader_end_user();
 }
 
@@ -60,6 +105,9 @@ bool leader_sequence_add(uint16_t keycode) {
 
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
+#ifdef LEADER_TABLE_SIZE
+    leader_table_node = leader_table_next(leader_table_node, keycode);
+#endif
 
     return true;
 }
@@ -76,6 +124,14 @@ void leader_reset_timer(void) {
     leader_time = timer_read();
 }
 
+bool leader_sequence_complete(void) {
+#ifdef LEADER_TABLE_SIZE
+    return leader_sequence_size > 0 && leader_table_node != LEADER_TABLE_NONE && pgm_read_word(&leader_table[leader_table_node]) == 0;
+#else
+    return false;
+#endif
+}
+
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
     return leader_sequence[0] == kc1 && leader_sequence[1] == kc2 && leader_sequence[2] == kc3 && leader_sequence[3] == kc4 && leader_sequence[4] == kc5;
 }
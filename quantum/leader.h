@@ -21,6 +21,17 @@ void leader_start_user(void);
  */
 void leader_end_user(void);
 
+/**
+ * \brief User callback, invoked when the sequence matches an entry of the leader table.
+ *
+ * Only called when a `leader_data.h` generated by `qmk generate-leader-data` is found.
+ *
+ * \param action The action the table gives for the sequence.
+ *
+ * \return `true` to tap the action as a keycode, `false` if it was handled here.
+ */
+bool leader_action_user(uint16_t action);
+
 /**
  * Begin the leader sequence, resetting the buffer and timer.
  */
@@ -61,6 +72,13 @@ bool leader_sequence_timed_out(void);
  */
 void leader_reset_timer(void);
 
+/**
+ * Whether the sequence matches an entry of the leader table that no other entry begins with.
+ *
+ * Always `false` without a leader table.
+ */
+bool leader_sequence_complete(void);
+
 /**
  * Check the sequence buffer for the given keycode.
  *
@@ -4,23 +4,40 @@
 
 typedef uint8_t (*reactive_splash_f)(uint8_t val, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
 
-bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func) {
+// Returns the largest distance at which a hit of the given age can still light an LED,
+// or a negative value once it can no longer light any LED at all.
+// Hits out of reach are skipped entirely, so only supply one when such a hit leaves the LED as it was.
+typedef int16_t (*reactive_splash_reach_f)(uint16_t tick);
+
+bool effect_runner_reactive_splash_reach(uint8_t start, effect_params_t* params, reactive_splash_f effect_func, reactive_splash_reach_f reach_func) {
     LED_MATRIX_USE_LIMITS(led_min, led_max);
 
-    uint8_t count = g_last_hit_tracker.count;
+    uint8_t  count = g_last_hit_tracker.count;
+    uint16_t tick[LED_HITS_TO_REMEMBER];
+    int16_t  reach[LED_HITS_TO_REMEMBER];
+    for (uint8_t j = start; j < count; j++) {
+        tick[j]  = scale16by8(g_last_hit_tracker.tick[j], led_matrix_eeconfig.speed);
+        reach[j] = reach_func ? reach_func(tick[j]) : INT16_MAX;
+    }
+
     for (uint8_t i = led_min; i < led_max; i++) {
         LED_MATRIX_TEST_LED_FLAGS();
         uint8_t val = 0;
         for (uint8_t j = start; j < count; j++) {
-            int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
-            int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
-            uint8_t  dist = sqrt16(dx * dx + dy * dy);
-            uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], led_matrix_eeconfig.speed);
-            val           = effect_func(val, dx, dy, dist, tick);
+            int16_t dx = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+            int16_t dy = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+            // dist is never smaller than either axis offset, so skip hits out of reach before the sqrt
+            if (abs(dx) > reach[j] || abs(dy) > reach[j]) continue;
+            uint8_t dist = sqrt16(dx * dx + dy * dy);
+            val          = effect_func(val, dx, dy, dist, tick[j]);
         }
         led_matrix_set_value(i, scale8(val, led_matrix_eeconfig.val));
     }
     return led_matrix_check_finished_leds(led_max);
 }
 
+bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func) {
+    return effect_runner_reactive_splash_reach(start, params, effect_func, NULL);
+}
+
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
@@ -22,15 +22,20 @@ static uint8_t SOLID_REACTIVE_CROSS_math(uint8_t val, int16_t dx, int16_t dy, ui
     return qadd8(val, 255 - effect);
 }
 
+static int16_t SOLID_REACTIVE_CROSS_reach(uint16_t tick) {
+    // tick + dist has to stay below 255
+    return tick < 255 ? 254 - tick : -1;
+}
+
 #            ifdef ENABLE_LED_MATRIX_SOLID_REACTIVE_CROSS
 bool SOLID_REACTIVE_CROSS(effect_params_t* params) {
-    return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_CROSS_math);
+    return effect_runner_reactive_splash_reach(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_CROSS_math, &SOLID_REACTIVE_CROSS_reach);
 }
 #            endif
 
 #            ifdef ENABLE_LED_MATRIX_SOLID_REACTIVE_MULTICROSS
 bool SOLID_REACTIVE_MULTICROSS(effect_params_t* params) {
-    return effect_runner_reactive_splash(0, params, &SOLID_REACTIVE_CROSS_math);
+    return effect_runner_reactive_splash_reach(0, params, &SOLID_REACTIVE_CROSS_math, &SOLID_REACTIVE_CROSS_reach);
 }
 #            endif
 
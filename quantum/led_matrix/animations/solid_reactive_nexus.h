@@ -19,15 +19,20 @@ static uint8_t SOLID_REACTIVE_NEXUS_math(uint8_t val, int16_t dx, int16_t dy, ui
     return qadd8(val, 255 - effect);
 }
 
+static int16_t SOLID_REACTIVE_NEXUS_reach(uint16_t tick) {
+    // dist has to stay within 72, and below tick by less than 255
+    return tick < 72 + 255 ? (tick < 72 ? tick : 72) : -1;
+}
+
 #            ifdef ENABLE_LED_MATRIX_SOLID_REACTIVE_NEXUS
 bool SOLID_REACTIVE_NEXUS(effect_params_t* params) {
-    return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_NEXUS_math);
+    return effect_runner_reactive_splash_reach(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_NEXUS_math, &SOLID_REACTIVE_NEXUS_reach);
 }
 #            endif
 
 #            ifdef ENABLE_LED_MATRIX_SOLID_REACTIVE_MULTINEXUS
 bool SOLID_REACTIVE_MULTINEXUS(effect_params_t* params) {
-    return effect_runner_reactive_splash(0, params, &SOLID_REACTIVE_NEXUS_math);
+    return effect_runner_reactive_splash_reach(0, params, &SOLID_REACTIVE_NEXUS_math, &SOLID_REACTIVE_NEXUS_reach);
 }
 #            endif
 
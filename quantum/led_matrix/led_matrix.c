@@ -70,6 +70,7 @@ last_hit_t g_last_hit_tracker;
 
 // internals
 static bool            suspend_state     = false;
+static bool            idle_state        = false; // drivers are blanked and shut down
 static uint8_t         led_last_enable   = UINT8_MAX;
 static uint8_t         led_last_effect   = UINT8_MAX;
 static effect_params_t led_effect_params = {0, LED_FLAG_ALL, false};
@@ -79,6 +80,12 @@ static led_task_states led_task_state    = SYNCING;
 static uint32_t led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
 static last_hit_t last_hit_buffer;
+static uint8_t    last_hit_head; // slot of the oldest hit, last_hit_buffer is a ring
+
+static inline uint8_t last_hit_slot(uint8_t offset) {
+    uint8_t slot = last_hit_head + offset;
+    return slot < LED_HITS_TO_REMEMBER ? slot : slot - LED_HITS_TO_REMEMBER;
+}
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
 // split led matrix
@@ -186,21 +193,20 @@ void led_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         led_count = led_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
+        uint8_t index;
+        if (last_hit_buffer.count < LED_HITS_TO_REMEMBER) {
+            index = last_hit_slot(last_hit_buffer.count);
+            last_hit_buffer.count++;
+        } else {
+            // Buffer is full, overwrite the oldest hit
+            index         = last_hit_head;
+            last_hit_head = last_hit_slot(1);
+        }
         last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
         last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
         last_hit_buffer.index[index] = led[i];
         last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
     }
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
@@ -228,13 +234,13 @@ static void led_task_timers(void) {
 
     // Update double buffer last hit timers
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
-            last_hit_buffer.count--;
-            continue;
-        }
-        last_hit_buffer.tick[i] += deltaTime;
+    // All hits age together, so the ones about to expire are always the oldest
+    while (last_hit_buffer.count > 0 && UINT16_MAX - deltaTime < last_hit_buffer.tick[last_hit_head]) {
+        last_hit_head = last_hit_slot(1);
+        last_hit_buffer.count--;
+    }
+    for (uint8_t i = 0; i < last_hit_buffer.count; ++i) {
+        last_hit_buffer.tick[last_hit_slot(i)] += deltaTime;
     }
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 }
@@ -252,7 +258,15 @@ static void led_task_start(void) {
     // update double buffers
     g_led_timer = led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker = last_hit_buffer;
+    // unroll the ring so effects see hits oldest first
+    g_last_hit_tracker.count = last_hit_buffer.count;
+    for (uint8_t i = 0; i < last_hit_buffer.count; ++i) {
+        uint8_t slot                = last_hit_slot(i);
+        g_last_hit_tracker.x[i]     = last_hit_buffer.x[slot];
+        g_last_hit_tracker.y[i]     = last_hit_buffer.y[slot];
+        g_last_hit_tracker.index[i] = last_hit_buffer.index[slot];
+        g_last_hit_tracker.tick[i]  = last_hit_buffer.tick[slot];
+    }
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
@@ -324,18 +338,53 @@ static void led_task_flush(uint8_t effect) {
     led_task_state = SYNCING;
 }
 
+static void led_task_enter_idle(void) {
+    if (idle_state) {
+        return;
+    }
+
+    // blank the LEDs once, then stop talking to the drivers
+    led_matrix_set_value_all(0);
+    led_matrix_update_pwm_buffers();
+    if (led_matrix_driver.shutdown) {
+        led_matrix_driver.shutdown();
+    }
+
+    led_last_effect = 0;
+    idle_state      = true;
+}
+
+static void led_task_exit_idle(void) {
+    if (!idle_state) {
+        return;
+    }
+
+    if (led_matrix_driver.exit_shutdown) {
+        led_matrix_driver.exit_shutdown();
+    }
+
+    // render a complete frame before the next flush
+    led_task_state = STARTING;
+    idle_state     = false;
+}
+
 void led_matrix_task(void) {
     led_task_timers();
 
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
 #if LED_MATRIX_TIMEOUT > 0
                              (last_input_activity_elapsed() > (uint32_t)LED_MATRIX_TIMEOUT) ||
 #endif // LED_MATRIX_TIMEOUT > 0
                              false;
 
-    uint8_t effect = suspend_backlight || !led_matrix_eeconfig.enable ? 0 : led_matrix_eeconfig.mode;
+    // Nothing is rendered or flushed while idle, the drivers stay shut down until woken
+    if (suspend_backlight) {
+        led_task_enter_idle();
+        return;
+    }
+    led_task_exit_idle();
+
+    uint8_t effect = led_matrix_eeconfig.enable ? led_matrix_eeconfig.mode : 0;
 
     switch (led_task_state) {
         case STARTING:
@@ -427,6 +476,7 @@ void led_matrix_init(void) {
     }
 
     last_hit_buffer.count = 0;
+    last_hit_head         = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         last_hit_buffer.tick[i] = UINT16_MAX;
     }
@@ -443,8 +493,7 @@ void led_matrix_init(void) {
 void led_matrix_set_suspend_state(bool state) {
 #ifdef LED_MATRIX_SLEEP
     if (state && !suspend_state && is_keyboard_master()) { // only run if turning off, and only once
-        led_task_render(0);                                // turn off all LEDs when suspending
-        led_task_flush(0);                                 // and actually flash led state to LEDs
+        led_task_enter_idle();                             // turn off all LEDs and shut the drivers down
     }
     suspend_state = state;
 #endif
@@ -127,6 +127,8 @@ const led_matrix_driver_t led_matrix_driver = {
     .flush         = snled27351_flush,
     .set_value     = snled27351_set_value,
     .set_value_all = snled27351_set_value_all,
+    .shutdown      = snled27351_sw_shutdown_all,
+    .exit_shutdown = snled27351_sw_return_normal_all,
 };
 
 #endif
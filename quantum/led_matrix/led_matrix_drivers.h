@@ -43,6 +43,10 @@ typedef struct {
     void (*set_value_all)(uint8_t value);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Put the hardware into a low power state while idle, optional. */
+    void (*shutdown)(void);
+    /* Bring the hardware back from the low power state, optional. */
+    void (*exit_shutdown)(void);
 } led_matrix_driver_t;
 
 extern const led_matrix_driver_t led_matrix_driver;
@@ -51,6 +51,21 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define MATRIX_INPUT_PRESSED_STATE 0
 #endif
 
+#ifdef MATRIX_PORT_READ
+#    if defined(DIRECT_PINS) || !defined(MATRIX_ROW_PINS) || !defined(MATRIX_COL_PINS)
+#        error MATRIX_PORT_READ requires MATRIX_ROW_PINS and MATRIX_COL_PINS
+#    endif
+#endif
+
+#ifdef MATRIX_SCAN_ON_CHANGE
+#    if !defined(DIRECT_PINS) && (!defined(MATRIX_ROW_PINS) || !defined(MATRIX_COL_PINS))
+#        error MATRIX_SCAN_ON_CHANGE requires DIRECT_PINS, or MATRIX_ROW_PINS and MATRIX_COL_PINS
+#    endif
+#    ifndef gpio_enable_pin_interrupt
+#        error MATRIX_SCAN_ON_CHANGE is not supported on this platform
+#    endif
+#endif
+
 #ifdef DIRECT_PINS
 static SPLIT_MUTABLE pin_t direct_pins[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
 #elif (DIODE_DIRECTION == ROW2COL) || (DIODE_DIRECTION == COL2ROW)
@@ -104,6 +119,87 @@ static inline uint8_t readMatrixPin(pin_t pin) {
     }
 }
 
+#ifdef MATRIX_PORT_READ
+#    if (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_INPUTS MATRIX_COLS
+#        define input_pins col_pins
+typedef matrix_row_t matrix_input_t;
+#    elif (ROWS_PER_HAND <= 8)
+#        define MATRIX_INPUTS ROWS_PER_HAND
+#        define input_pins row_pins
+typedef uint8_t matrix_input_t;
+#    elif (ROWS_PER_HAND <= 16)
+#        define MATRIX_INPUTS ROWS_PER_HAND
+#        define input_pins row_pins
+typedef uint16_t matrix_input_t;
+#    else
+#        define MATRIX_INPUTS ROWS_PER_HAND
+#        define input_pins row_pins
+typedef uint32_t matrix_input_t;
+#    endif
+
+// Input pins that sit on the same port and keep their order, moved into place by one shift
+typedef struct {
+    uint8_t          port;  // index into input_ports[]
+    int8_t           shift; // input index minus port bit
+    gpio_port_data_t mask;
+} matrix_input_run_t;
+
+static gpio_port_t        input_ports[MATRIX_INPUTS];
+static uint8_t            input_port_count;
+static matrix_input_run_t input_runs[MATRIX_INPUTS];
+static uint8_t            input_run_count;
+
+static void init_input_runs(void) {
+    input_port_count = 0;
+    input_run_count  = 0;
+    for (uint8_t x = 0; x < MATRIX_INPUTS; x++) {
+        pin_t pin = input_pins[x];
+        if (pin == NO_PIN) {
+            continue;
+        }
+
+        uint8_t port = 0;
+        while (port < input_port_count && input_ports[port] != gpio_pin_port(pin)) {
+            port++;
+        }
+        if (port == input_port_count) {
+            input_ports[input_port_count++] = gpio_pin_port(pin);
+        }
+
+        int8_t  shift = (int8_t)x - (int8_t)gpio_pin_bit(pin);
+        uint8_t run   = 0;
+        while (run < input_run_count && (input_runs[run].port != port || input_runs[run].shift != shift)) {
+            run++;
+        }
+        if (run == input_run_count) {
+            input_runs[input_run_count++] = (matrix_input_run_t){.port = port, .shift = shift};
+        }
+        input_runs[run].mask |= (gpio_port_data_t)1 << gpio_pin_bit(pin);
+    }
+}
+
+// Reads every input port once, returning a bit per input that is set when it is pressed
+static matrix_input_t read_inputs(void) {
+    gpio_port_data_t port_data[MATRIX_INPUTS];
+    for (uint8_t port = 0; port < input_port_count; port++) {
+#    if MATRIX_INPUT_PRESSED_STATE
+        port_data[port] = gpio_read_port(input_ports[port]);
+#    else
+        port_data[port] = ~gpio_read_port(input_ports[port]);
+#    endif
+    }
+
+    matrix_input_t inputs = 0;
+    for (uint8_t run = 0; run < input_run_count; run++) {
+        gpio_port_data_t bits  = port_data[input_runs[run].port] & input_runs[run].mask;
+        int8_t           shift = input_runs[run].shift;
+        inputs |= shift >= 0 ? (matrix_input_t)bits << shift : (matrix_input_t)(bits >> -shift);
+    }
+    return inputs;
+}
+#endif
+
 // matrix code
 
 #ifdef DIRECT_PINS
@@ -181,6 +277,9 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_READ
+    current_row_value = read_inputs();
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -189,6 +288,7 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
@@ -244,10 +344,18 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_READ
+    matrix_input_t rows = read_inputs();
+#            endif
+
     // For each row...
     for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
         // Check row pin state
+#            ifdef MATRIX_PORT_READ
+        if (rows & ((matrix_input_t)1 << row_index)) {
+#            else
         if (readMatrixPin(row_pins[row_index]) == 0) {
+#            endif
             // Pin LO, set col bit
             current_matrix[row_index] |= row_shifter;
             key_pressed = true;
@@ -270,6 +378,88 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_SCAN_ON_CHANGE
+#    if defined(DIRECT_PINS)
+#        define IDLE_INPUTS (ROWS_PER_HAND * MATRIX_COLS)
+#        define idle_input_pins (&direct_pins[0][0])
+#    elif (DIODE_DIRECTION == COL2ROW)
+#        define IDLE_INPUTS MATRIX_COLS
+#        define idle_input_pins col_pins
+#    else
+#        define IDLE_INPUTS ROWS_PER_HAND
+#        define idle_input_pins row_pins
+#    endif
+
+static bool          matrix_idle;
+static volatile bool matrix_woken;
+
+static void matrix_wake(void *arg) {
+    matrix_woken = true;
+}
+
+// Selects every row (or col) at once, so that pressing any key changes an input
+static void set_idle_strobes(bool active) {
+#    if defined(DIRECT_PINS)
+    (void)active;
+#    elif (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+        if (active) {
+            select_row(x);
+        } else {
+            unselect_row(x);
+        }
+    }
+#    else
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        if (active) {
+            select_col(x);
+        } else {
+            unselect_col(x);
+        }
+    }
+#    endif
+}
+
+static void matrix_idle_enter(void) {
+    matrix_woken = false;
+    set_idle_strobes(true);
+    for (uint8_t x = 0; x < IDLE_INPUTS; x++) {
+        if (idle_input_pins[x] != NO_PIN) {
+            gpio_enable_pin_interrupt(idle_input_pins[x], matrix_wake);
+        }
+    }
+    matrix_output_select_delay();
+
+    // A key pressed before its interrupt was enabled has no edge left to wake on
+    for (uint8_t x = 0; x < IDLE_INPUTS; x++) {
+        if (readMatrixPin(idle_input_pins[x]) == 0) {
+            matrix_woken = true;
+        }
+    }
+    matrix_idle = true;
+}
+
+static void matrix_idle_exit(void) {
+    for (uint8_t x = 0; x < IDLE_INPUTS; x++) {
+        if (idle_input_pins[x] != NO_PIN) {
+            gpio_disable_pin_interrupt(idle_input_pins[x]);
+        }
+    }
+    set_idle_strobes(false);
+    matrix_output_unselect_delay(0, true); // wait for all inputs to go back to their unpressed level
+    matrix_idle = false;
+}
+
+static bool matrix_released(const matrix_row_t rows[]) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (rows[row]) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -300,6 +490,14 @@ void matrix_init(void) {
     thatHand = ROWS_PER_HAND - thisHand;
 #endif
 
+#ifdef MATRIX_PORT_READ
+    init_input_runs();
+#endif
+
+#ifdef MATRIX_SCAN_ON_CHANGE
+    matrix_idle = false;
+#endif
+
     // initialize key pins
     matrix_init_pins();
 
@@ -320,9 +518,7 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
-uint8_t matrix_scan(void) {
-    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
-
+static void matrix_read(matrix_row_t curr_matrix[]) {
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
@@ -335,6 +531,22 @@ uint8_t matrix_scan(void) {
         matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
     }
 #endif
+}
+
+uint8_t matrix_scan(void) {
+    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
+
+#ifdef MATRIX_SCAN_ON_CHANGE
+    if (matrix_idle && matrix_woken) {
+        matrix_idle_exit();
+    }
+    // Nothing is pressed while idle, which is what curr_matrix already holds
+    if (!matrix_idle) {
+        matrix_read(curr_matrix);
+    }
+#else
+    matrix_read(curr_matrix);
+#endif
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
@@ -345,5 +557,16 @@ uint8_t matrix_scan(void) {
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
     matrix_scan_kb();
 #endif
+
+#ifdef MATRIX_SCAN_ON_CHANGE
+    // With every key released, and debounce caught up, there is nothing to scan for until a key is pressed
+#    ifdef SPLIT_KEYBOARD
+    if (!matrix_idle && matrix_released(raw_matrix) && matrix_released(matrix + thisHand)) {
+#    else
+    if (!matrix_idle && matrix_released(raw_matrix) && matrix_released(matrix)) {
+#    endif
+        matrix_idle_enter();
+    }
+#endif
     return (uint8_t)changed;
 }
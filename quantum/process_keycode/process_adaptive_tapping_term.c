@@ -0,0 +1,230 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "process_adaptive_tapping_term.h"
+#include "action_tapping.h"
+#include "bitwise.h"
+#include "keycodes.h"
+#include "timer.h"
+#include "util.h"
+
+_Static_assert(ADAPTIVE_TAPPING_TERM_WINDOW < 256, "ADAPTIVE_TAPPING_TERM_WINDOW must be less than 256");
+_Static_assert(ADAPTIVE_TAPPING_TERM_MIN_SAMPLES <= ADAPTIVE_TAPPING_TERM_WINDOW / 2, "ADAPTIVE_TAPPING_TERM_MIN_SAMPLES must be at most half of ADAPTIVE_TAPPING_TERM_WINDOW");
+
+/* How long taps are held, in bins that get wider as they get longer, so a few bytes cover fast and
+ * slow typing alike. Once the window is full every bin is halved, so old typing fades out. */
+typedef struct {
+    uint8_t  bins[ADAPTIVE_TAPPING_TERM_BINS];
+    uint8_t  total;
+    uint16_t term; // percentile plus margin, or 0 with too few samples
+} adaptive_histogram_t;
+
+typedef struct {
+    keypos_t             key;
+    bool                 in_use;
+    bool                 pressed;
+    bool                 interrupted; // another key went down while this one was
+    uint16_t             pressed_at;
+    uint32_t             last_pressed;
+    adaptive_histogram_t taps;
+} adaptive_key_t;
+
+static adaptive_key_t       adaptive_keys[ADAPTIVE_TAPPING_TERM_KEYS];
+static adaptive_histogram_t adaptive_global;
+
+static uint16_t base_tapping_term(void) {
+#ifdef DYNAMIC_TAPPING_TERM_ENABLE
+    return g_tapping_term;
+#else
+    return TAPPING_TERM;
+#endif
+}
+
+static bool is_tap_hold_keycode(uint16_t keycode) {
+    return IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode);
+}
+
+/* Bin 0 starts at 32ms, each bin after is 1/4 of a doubling wider than the last. */
+static uint8_t histogram_bin(uint16_t duration) {
+    if (duration < 32) {
+        return 0;
+    }
+    uint8_t msb = biton16(duration);
+    return MIN(4 * (msb - 5) + ((duration >> (msb - 2)) & 3), ADAPTIVE_TAPPING_TERM_BINS - 1);
+}
+
+/* Walks the bins up to the one the percentile falls into, and interpolates within it. */
+static uint16_t histogram_percentile(const adaptive_histogram_t *histogram) {
+    uint16_t wanted = ((uint16_t)histogram->total * ADAPTIVE_TAPPING_TERM_PERCENTILE + 99) / 100;
+    uint16_t seen   = 0;
+
+    for (uint8_t bin = 0; bin < ADAPTIVE_TAPPING_TERM_BINS; bin++) {
+        if (seen + histogram->bins[bin] >= wanted && histogram->bins[bin]) {
+            uint8_t shift = bin / 4 + 3;
+            return ((4 + (bin & 3)) << shift) + (((wanted - seen) << shift) / histogram->bins[bin]);
+        }
+        seen += histogram->bins[bin];
+    }
+    return 512;
+}
+
+static void histogram_add(adaptive_histogram_t *histogram, uint16_t duration) {
+    if (histogram->total >= ADAPTIVE_TAPPING_TERM_WINDOW) {
+        histogram->total = 0;
+        for (uint8_t bin = 0; bin < ADAPTIVE_TAPPING_TERM_BINS; bin++) {
+            histogram->bins[bin] >>= 1;
+            histogram->total += histogram->bins[bin];
+        }
+    }
+    histogram->bins[histogram_bin(duration)]++;
+    histogram->total++;
+    histogram->term = histogram->total >= ADAPTIVE_TAPPING_TERM_MIN_SAMPLES ? histogram_percentile(histogram) + ADAPTIVE_TAPPING_TERM_MARGIN : 0;
+}
+
+static adaptive_key_t *find_key(keypos_t key) {
+    for (uint8_t i = 0; i < ADAPTIVE_TAPPING_TERM_KEYS; i++) {
+        if (adaptive_keys[i].in_use && KEYEQ(adaptive_keys[i].key, key)) {
+            return &adaptive_keys[i];
+        }
+    }
+    return NULL;
+}
+
+/* Finds the key's statistics, or starts them over in a free slot or the least recently pressed one. */
+static adaptive_key_t *claim_key(keypos_t key) {
+    adaptive_key_t *found = find_key(key);
+    if (found) {
+        return found;
+    }
+
+    for (uint8_t i = 0; i < ADAPTIVE_TAPPING_TERM_KEYS; i++) {
+        adaptive_key_t *slot = &adaptive_keys[i];
+        if (!slot->in_use) {
+            found = slot;
+            break;
+        }
+        if (!slot->pressed && (!found || TIMER_DIFF_32(found->last_pressed, slot->last_pressed) < UINT32_MAX / 2)) {
+            found = slot;
+        }
+    }
+    if (found) {
+        memset(found, 0, sizeof(adaptive_key_t));
+        found->key    = key;
+        found->in_use = true;
+    }
+    return found;
+}
+
+static uint16_t clamp_term(uint16_t term) {
+    uint16_t base = base_tapping_term();
+    if (!term) {
+        return base;
+    }
+    return MIN(MAX(term, ADAPTIVE_TAPPING_TERM_MIN), base);
+}
+
+uint16_t get_adaptive_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    if (!is_tap_hold_keycode(keycode)) {
+        return base_tapping_term();
+    }
+    adaptive_key_t *slot = find_key(record->event.key);
+    return clamp_term(slot && slot->taps.term ? slot->taps.term : adaptive_global.term);
+}
+
+void adaptive_tapping_term_reset(void) {
+    memset(adaptive_keys, 0, sizeof(adaptive_keys));
+    memset(&adaptive_global, 0, sizeof(adaptive_global));
+}
+
+/* Samples how long tap-hold keys are held when they are meant as taps: those that were tapped, and
+ * those settled as held that nothing interrupted and that the unadapted tapping term would have
+ * tapped, so a tapping term brought too low climbs back up. */
+bool process_adaptive_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    if (record->event.pressed) {
+        for (uint8_t i = 0; i < ADAPTIVE_TAPPING_TERM_KEYS; i++) {
+            adaptive_keys[i].interrupted |= adaptive_keys[i].pressed;
+        }
+        if (is_tap_hold_keycode(keycode)) {
+            adaptive_key_t *slot = claim_key(record->event.key);
+            if (slot) {
+                slot->pressed      = true;
+                slot->interrupted  = false;
+                slot->pressed_at   = record->event.time;
+                slot->last_pressed = timer_read32();
+            }
+        }
+        return true;
+    }
+
+    adaptive_key_t *slot = is_tap_hold_keycode(keycode) ? find_key(record->event.key) : NULL;
+    if (slot && slot->pressed) {
+        uint16_t duration = TIMER_DIFF_16(record->event.time, slot->pressed_at);
+        slot->pressed     = false;
+        if (duration < base_tapping_term() && (record->tap.count > 0 || !slot->interrupted)) {
+            histogram_add(&slot->taps, duration);
+            histogram_add(&adaptive_global, duration);
+        }
+    }
+    return true;
+}
+
+#ifdef RAW_ENABLE
+/* Answers in place, the reply is to be sent back as is:
+ *   info:  [ id, 0x00 ] -> [ id, 0x00, keys, bins, min (BE16), base (BE16), percentile, margin, min samples, window ]
+ *   get:   [ id, 0x01, index ] -> [ id, 0x01, index, in use, row, col, term (BE16), samples, bins... ]
+ *          with index ADAPTIVE_TAPPING_TERM_GLOBAL for the keyboard-wide statistics
+ *   reset: [ id, 0x02 ] -> [ id, 0x02 ]
+ * Unknown operations are answered with 0xFF in place of the operation. */
+bool adaptive_tapping_term_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 9 + ADAPTIVE_TAPPING_TERM_BINS || data[0] != ADAPTIVE_TAPPING_TERM_RAW_HID_ID) {
+        return false;
+    }
+
+    switch (data[1]) {
+        case id_adaptive_tapping_term_info: {
+            uint16_t base = base_tapping_term();
+            data[2]       = ADAPTIVE_TAPPING_TERM_KEYS;
+            data[3]       = ADAPTIVE_TAPPING_TERM_BINS;
+            data[4]       = ADAPTIVE_TAPPING_TERM_MIN >> 8;
+            data[5]       = ADAPTIVE_TAPPING_TERM_MIN & 0xFF;
+            data[6]       = base >> 8;
+            data[7]       = base & 0xFF;
+            data[8]       = ADAPTIVE_TAPPING_TERM_PERCENTILE;
+            data[9]       = ADAPTIVE_TAPPING_TERM_MARGIN;
+            data[10]      = ADAPTIVE_TAPPING_TERM_MIN_SAMPLES;
+            data[11]      = ADAPTIVE_TAPPING_TERM_WINDOW;
+            break;
+        }
+        case id_adaptive_tapping_term_get: {
+            const adaptive_histogram_t *taps = &adaptive_global;
+            uint16_t                    term = clamp_term(adaptive_global.term);
+            memset(&data[3], 0, length - 3);
+            if (data[2] == ADAPTIVE_TAPPING_TERM_GLOBAL) {
+                data[3] = true;
+            } else if (data[2] < ADAPTIVE_TAPPING_TERM_KEYS && adaptive_keys[data[2]].in_use) {
+                const adaptive_key_t *slot = &adaptive_keys[data[2]];
+                taps                       = &slot->taps;
+                term                       = clamp_term(slot->taps.term ? slot->taps.term : adaptive_global.term);
+                data[3]                    = true;
+                data[4]                    = slot->key.row;
+                data[5]                    = slot->key.col;
+            } else {
+                break;
+            }
+            data[6] = term >> 8;
+            data[7] = term & 0xFF;
+            data[8] = taps->total;
+            memcpy(&data[9], taps->bins, ADAPTIVE_TAPPING_TERM_BINS);
+            break;
+        }
+        case id_adaptive_tapping_term_reset:
+            adaptive_tapping_term_reset();
+            break;
+        default:
+            data[1] = 0xFF;
+            break;
+    }
+    return true;
+}
+#endif
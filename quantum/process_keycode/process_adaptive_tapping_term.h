@@ -0,0 +1,63 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "action.h"
+
+/* number of tap-hold keys tracked separately, least recently pressed ones make way */
+#ifndef ADAPTIVE_TAPPING_TERM_KEYS
+#    define ADAPTIVE_TAPPING_TERM_KEYS 8
+#endif
+
+/* the tapping term is never brought below this (ms) */
+#ifndef ADAPTIVE_TAPPING_TERM_MIN
+#    define ADAPTIVE_TAPPING_TERM_MIN 100
+#endif
+
+/* percentage of taps expected to be let go within the adapted tapping term */
+#ifndef ADAPTIVE_TAPPING_TERM_PERCENTILE
+#    define ADAPTIVE_TAPPING_TERM_PERCENTILE 95
+#endif
+
+/* added to the percentile to get the tapping term (ms) */
+#ifndef ADAPTIVE_TAPPING_TERM_MARGIN
+#    define ADAPTIVE_TAPPING_TERM_MARGIN 25
+#endif
+
+/* taps needed before a key, or the keyboard as a whole, adapts */
+#ifndef ADAPTIVE_TAPPING_TERM_MIN_SAMPLES
+#    define ADAPTIVE_TAPPING_TERM_MIN_SAMPLES 16
+#endif
+
+/* samples a histogram holds before older ones are halved away */
+#ifndef ADAPTIVE_TAPPING_TERM_WINDOW
+#    define ADAPTIVE_TAPPING_TERM_WINDOW 128
+#endif
+
+/* first byte of the raw HID reports handled by adaptive_tapping_term_raw_hid_receive(), not assigned by VIA */
+#ifndef ADAPTIVE_TAPPING_TERM_RAW_HID_ID
+#    define ADAPTIVE_TAPPING_TERM_RAW_HID_ID 0x17
+#endif
+
+/* histogram bins, four to each doubling from 32ms to 512ms */
+#define ADAPTIVE_TAPPING_TERM_BINS 16
+
+/* index of the keyboard-wide statistics, used for keys with too few samples of their own */
+#define ADAPTIVE_TAPPING_TERM_GLOBAL 0xFF
+
+enum adaptive_tapping_term_raw_hid_op {
+    id_adaptive_tapping_term_info  = 0x00,
+    id_adaptive_tapping_term_get   = 0x01,
+    id_adaptive_tapping_term_reset = 0x02,
+};
+
+bool     process_adaptive_tapping_term(uint16_t keycode, keyrecord_t *record);
+uint16_t get_adaptive_tapping_term(uint16_t keycode, keyrecord_t *record);
+void     adaptive_tapping_term_reset(void);
+
+#ifdef RAW_ENABLE
+bool adaptive_tapping_term_raw_hid_receive(uint8_t *data, uint8_t length);
+#endif
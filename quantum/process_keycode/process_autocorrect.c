@@ -22,6 +22,14 @@
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+#ifdef AUTOCORRECT_AUTOMATON
+// Automaton node reached after the first `automaton_state_size` characters of `typo_buffer`.
+// When the buffer is changed behind our back, e.g. by a backspace, the sizes no longer
+// line up and the state is rebuilt from the buffer.
+static uint16_t automaton_state      = 0;
+static uint8_t  automaton_state_size = 0;
+#endif
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -189,6 +197,125 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#ifdef AUTOCORRECT_AUTOMATON
+/**
+ * @brief follows the automaton in `autocorrect_data` from `state` by one keycode
+ *
+ * Nodes without a transition for the keycode fall back along their failure link,
+ * like in Aho-Corasick, until one has it or the root is reached.
+ *
+ * @param state byte offset of the current node
+ * @param keycode KC_A to KC_Z, KC_QUOTE or KC_SPC
+ * @return byte offset of the next node
+ */
+static uint16_t autocorrect_automaton_step(uint16_t state, uint8_t keycode) {
+    while (true) {
+        uint8_t const code = pgm_read_byte(autocorrect_data + state);
+        // Leaves have no transitions, as no typo contains another.
+        if (code & 128) {
+            state = 0;
+            continue;
+        }
+
+        // Transitions are sorted by keycode.
+        uint16_t transition = state + 3;
+        for (uint8_t i = code; i > 0; --i, transition += 3) {
+            uint8_t const key_i = pgm_read_byte(autocorrect_data + transition);
+            if (key_i == keycode) {
+                return pgm_read_byte(autocorrect_data + transition + 1) | pgm_read_byte(autocorrect_data + transition + 2) << 8;
+            }
+            if (key_i > keycode) {
+                break;
+            }
+        }
+
+        if (state == 0) {
+            return 0;
+        }
+        // Follow the failure link.
+        state = pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8;
+    }
+}
+#endif
+
+/**
+ * @brief corrects the typo at the end of the buffer
+ *
+ * @param code first byte of the leaf found, holding the number of backspaces
+ * @param changes pointer to PROGMEM string to replace mistyped seletion with
+ * @param keycode the keycode that completed the typo
+ * @param record keyrecord_t structure
+ * @return true Continue processing keycodes, and send to host
+ * @return false Stop processing keycodes, and don't send to host
+ */
+static bool autocorrect_apply_correction(uint8_t code, const char *changes, uint16_t keycode, keyrecord_t *record) {
+    const uint8_t backspaces = (code & 63) + !record->event.pressed;
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
+        }
+
+        ++typo_len;
+    }
+
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
+
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
+
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
+        }
+        send_string_P(changes);
+#ifdef SEND_STRING_ASYNC
+        // The space goes out as soon as this returns, so the correction must be typed out first
+        send_string_queue_flush();
+#endif
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
+    }
+}
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -270,10 +397,37 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
         memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
         typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+#ifdef AUTOCORRECT_AUTOMATON
+        // No typo is longer than the buffer, so the state still holds for what is left of it.
+        if (automaton_state_size == AUTOCORRECT_MAX_LENGTH) {
+            automaton_state_size = AUTOCORRECT_MAX_LENGTH - 1;
+        }
+#endif
     }
 
     // Append `keycode` to buffer.
     typo_buffer[typo_buffer_size++] = keycode;
+
+#ifdef AUTOCORRECT_AUTOMATON
+    // Advance the automaton stored in `autocorrect_data` by the new character.
+    if (automaton_state_size != typo_buffer_size - 1) {
+        automaton_state = 0;
+        for (uint8_t i = 0; i < typo_buffer_size - 1; ++i) {
+            automaton_state = autocorrect_automaton_step(automaton_state, typo_buffer[i]);
+        }
+    }
+    automaton_state      = autocorrect_automaton_step(automaton_state, keycode);
+    automaton_state_size = typo_buffer_size;
+
+    uint8_t const code = pgm_read_byte(autocorrect_data + automaton_state);
+    if (code & 128) { // A typo was found! Apply autocorrect.
+        const char *changes = (const char *)(autocorrect_data + automaton_state + 1);
+        // The buffer is reset below, start again from the root.
+        automaton_state      = 0;
+        automaton_state_size = 0;
+        return autocorrect_apply_correction(code, changes, keycode, record);
+    }
+#else
     // Return if buffer is smaller than the shortest word.
     if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
         return true;
@@ -308,69 +462,9 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         code = pgm_read_byte(autocorrect_data + state);
 
         if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
-
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
-
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
-
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+            return autocorrect_apply_correction(code, (const char *)(autocorrect_data + state + 1), keycode, record);
         }
     }
+#endif
     return true;
 }
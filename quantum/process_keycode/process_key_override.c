@@ -84,6 +84,23 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+#ifdef KEY_OVERRIDE_INDEX_ENABLE
+// Positions of the key overrides, sorted by trigger keycode and then by position. An event can only activate overrides triggered by its own keycode, the last key pressed down or KC_NO, so only those runs of the index are checked.
+static uint8_t  *key_override_index       = NULL;
+static uint16_t key_override_index_count = 0;
+static bool     key_override_indexed     = false;
+#endif
+
+// The key overrides that may activate on an event, in the order they are defined in
+typedef struct {
+    uint16_t next;
+#ifdef KEY_OVERRIDE_INDEX_ENABLE
+    uint8_t  runs;
+    uint16_t trigger[3];
+    uint16_t position[3];
+#endif
+} key_override_candidates_t;
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -110,6 +127,120 @@ bool key_override_is_enabled(void) {
     return enabled;
 }
 
+#ifdef KEY_OVERRIDE_INDEX_ENABLE
+static inline uint16_t key_override_index_trigger(uint16_t position) {
+    return key_override_get(key_override_index[position])->trigger;
+}
+
+// Returns the position in the index of the first key override with the given trigger, or where it would be
+static uint16_t key_override_index_find(uint16_t trigger) {
+    uint16_t low = 0, high = key_override_index_count;
+    while (low < high) {
+        uint16_t middle = low + (high - low) / 2;
+        if (key_override_index_trigger(middle) < trigger) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+#endif
+
+void key_override_init(void) {
+#ifdef KEY_OVERRIDE_INDEX_ENABLE
+    key_override_indexed     = false;
+    key_override_index_count = 0;
+
+    // With more key overrides than fit, every key override is checked on every event
+    const uint16_t count = key_override_count();
+    if (count > key_override_index_size()) {
+        key_override_printf("Not indexing key overrides: %u overrides, index size is %u\n", count, key_override_index_size());
+        return;
+    }
+    key_override_index = key_override_index_buffer();
+
+    // Insertion sort, keeping overrides with the same trigger in the order they are defined in
+    for (uint16_t i = 0; i < count; i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
+        }
+
+        uint16_t position = key_override_index_count++;
+        while (position > 0 && key_override_index_trigger(position - 1) > override->trigger) {
+            key_override_index[position] = key_override_index[position - 1];
+            --position;
+        }
+        key_override_index[position] = i;
+    }
+
+    key_override_indexed = true;
+#endif
+}
+
+static void key_override_candidates_init(key_override_candidates_t *candidates, const uint16_t keycode) {
+    candidates->next = 0;
+#ifdef KEY_OVERRIDE_INDEX_ENABLE
+    candidates->runs = 0;
+    if (!key_override_indexed) {
+        return;
+    }
+
+    const uint16_t triggers[] = {keycode, KC_NO, last_key_down};
+    for (uint8_t i = 0; i < ARRAY_SIZE(triggers); i++) {
+        bool seen = false;
+        for (uint8_t run = 0; run < candidates->runs; run++) {
+            seen |= candidates->trigger[run] == triggers[i];
+        }
+        if (seen) {
+            continue;
+        }
+
+        const uint16_t position = key_override_index_find(triggers[i]);
+        if (position < key_override_index_count && key_override_index_trigger(position) == triggers[i]) {
+            candidates->trigger[candidates->runs]    = triggers[i];
+            candidates->position[candidates->runs++] = position;
+        }
+    }
+#endif
+}
+
+// Returns the next key override that may activate, or NULL once there are none left
+static const key_override_t *key_override_candidates_next(key_override_candidates_t *candidates) {
+#ifdef KEY_OVERRIDE_INDEX_ENABLE
+    if (key_override_indexed) {
+        // Take the earliest defined override from the head of each run
+        uint8_t first = candidates->runs;
+        for (uint8_t run = 0; run < candidates->runs; run++) {
+            if (first == candidates->runs || key_override_index[candidates->position[run]] < key_override_index[candidates->position[first]]) {
+                first = run;
+            }
+        }
+        if (first == candidates->runs) {
+            return NULL;
+        }
+
+        const key_override_t *const override = key_override_get(key_override_index[candidates->position[first]]);
+
+        // Drop the run once it reaches the next trigger
+        if (++candidates->position[first] == key_override_index_count || key_override_index_trigger(candidates->position[first]) != candidates->trigger[first]) {
+            --candidates->runs;
+            candidates->trigger[first]  = candidates->trigger[candidates->runs];
+            candidates->position[first] = candidates->position[candidates->runs];
+        }
+        return override;
+    }
+#endif
+
+    if (candidates->next >= key_override_count()) {
+        return NULL;
+    }
+    return key_override_get(candidates->next++);
+}
+
 // Returns whether the modifiers that are pressed are such that the override should activate
 static bool key_override_matches_active_modifiers(const key_override_t *override, const uint8_t mods) {
     // Check that negative keys pass
@@ -243,19 +374,17 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
+/** Iterates through the key overrides that could be triggered by this event and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
 static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
     if (key_override_count() == 0) {
         return true;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
-        const key_override_t *const override = key_override_get(i);
+    key_override_candidates_t candidates;
+    key_override_candidates_init(&candidates, keycode);
 
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    const key_override_t *override;
+    while ((override = key_override_candidates_next(&candidates)) != NULL) {
 
         // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
         if (active_mods == 0 && override->trigger_mods != 0) {
@@ -22,6 +22,11 @@
 #include "action.h"
 #include "action_layer.h"
 
+// Key overrides are indexed by trigger keycode, unless KEY_OVERRIDE_INDEX_SIZE is set to 0
+#if !defined(KEY_OVERRIDE_INDEX_SIZE) || KEY_OVERRIDE_INDEX_SIZE > 0
+#    define KEY_OVERRIDE_INDEX_ENABLE
+#endif
+
 /**
  * Key overrides allow you to send a different key-modifier combination or perform a custom action when a certain modifier-key combination is pressed.
  *
@@ -87,6 +92,9 @@ typedef struct key_override_t {
     bool *enabled;
 } key_override_t;
 
+/** Indexes the key overrides by trigger keycode. Call again if the key overrides returned by key_override_get() change. */
+void key_override_init(void);
+
 /** Turns key overrides on */
 void key_override_on(void);
 
@@ -35,6 +35,13 @@ bool process_leader(uint16_t keycode, keyrecord_t *record) {
                 return true;
             }
 
+            // Nothing in the leader table can follow, so there is no need to wait for the timeout.
+            if (leader_sequence_complete()) {
+                leader_end();
+
+                return false;
+            }
+
 #ifdef LEADER_PER_KEY_TIMING
             leader_reset_timer();
 #endif
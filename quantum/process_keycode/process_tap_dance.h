@@ -21,6 +21,11 @@
 #include "action.h"
 #include "quantum_keycodes.h"
 
+/* number of dances that can be going on, or held down after finishing, at once */
+#ifndef TAP_DANCE_MAX_SIMULTANEOUS
+#    define TAP_DANCE_MAX_SIMULTANEOUS 8
+#endif
+
 typedef struct {
     uint16_t interrupting_keycode;
     uint8_t  count;
@@ -28,15 +33,16 @@ typedef struct {
 #ifndef NO_ACTION_ONESHOT
     uint8_t oneshot_mods;
 #endif
-    bool pressed : 1;
-    bool finished : 1;
-    bool interrupted : 1;
+    bool    pressed : 1;
+    bool    finished : 1;
+    bool    interrupted : 1;
+    bool    in_use : 1;
+    uint8_t index;
 } tap_dance_state_t;
 
 typedef void (*tap_dance_user_fn_t)(tap_dance_state_t *state, void *user_data);
 
 typedef struct tap_dance_action_t {
-    tap_dance_state_t state;
     struct {
         tap_dance_user_fn_t on_each_tap;
         tap_dance_user_fn_t on_dance_finished;
@@ -76,10 +82,13 @@ typedef struct {
     { .fn = {user_fn_on_each_tap, user_fn_on_dance_finished, user_fn_on_dance_reset, user_fn_on_each_release}, .user_data = NULL, }
 
 #define TD_INDEX(code) QK_TAP_DANCE_GET_INDEX(code)
-#define TAP_DANCE_KEYCODE(state) TD(((tap_dance_action_t *)state) - tap_dance_actions)
+#define TAP_DANCE_KEYCODE(state) TD((state)->index)
 
 void reset_tap_dance(tap_dance_state_t *state);
 
+// The state of a dance that is going on or still held down, NULL otherwise.
+tap_dance_state_t *tap_dance_get_state(uint8_t tap_dance_idx);
+
 /* To be used internally */
 
 bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record);
@@ -189,6 +189,9 @@ __attribute__((weak)) void post_process_record_kb(uint16_t keycode, keyrecord_t
 __attribute__((weak)) void post_process_record_user(uint16_t keycode, keyrecord_t *record) {}
 
 void shutdown_quantum(bool jump_to_bootloader) {
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC)
+    send_string_queue_flush();
+#endif
     clear_keyboard();
 #if defined(MIDI_ENABLE) && defined(MIDI_BASIC)
     process_midi_all_notes_off();
@@ -210,6 +213,7 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+    eeconfig_flush();
 }
 
 void reset_keyboard(void) {
@@ -311,6 +315,14 @@ bool process_record_quantum(keyrecord_t *record) {
     }
 #endif
 
+#if defined(UNICODE_COMMON_ENABLE) && defined(UNICODE_ASYNC)
+    // Finish typing out queued code points before any other key, so it does not land in the middle of
+    // one. Pairs pick the code point by the mods, which are cleared while one is typed out.
+    if (!IS_QK_UNICODE(keycode) && !IS_QK_UNICODEMAP(keycode)) {
+        unicode_queue_flush();
+    }
+#endif
+
     if (!(
 #if defined(KEY_LOCK_ENABLE)
             // Must run first to be able to mask key_up events.
@@ -320,6 +332,10 @@ bool process_record_quantum(keyrecord_t *record) {
             // Must run asap to ensure all keypresses are recorded.
             process_dynamic_macro(keycode, record) &&
 #endif
+#ifdef ADAPTIVE_TAPPING_TERM_ENABLE
+            // Must run before anything that can swallow a key, to time every tap.
+            process_adaptive_tapping_term(keycode, record) &&
+#endif
 #ifdef REPEAT_KEY_ENABLE
             process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
 #endif
@@ -571,6 +587,7 @@ void suspend_power_down_quantum(void) {
     pointing_device_task();
 #    endif
 #endif
+    eeconfig_flush();
 }
 
 __attribute__((weak)) void suspend_wakeup_init_quantum(void) {
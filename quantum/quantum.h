@@ -130,6 +130,10 @@ extern layer_state_t layer_state;
 #    include "process_dynamic_tapping_term.h"
 #endif
 
+#ifdef ADAPTIVE_TAPPING_TERM_ENABLE
+#    include "process_adaptive_tapping_term.h"
+#endif
+
 #ifdef COMBO_ENABLE
 #    include "process_combo.h"
 #endif
@@ -2,7 +2,7 @@
 
 typedef hsv_t (*sin_cos_i_f)(hsv_t hsv, int8_t sin, int8_t cos, uint8_t i, uint8_t time);
 
-bool effect_runner_sin_cos_i(effect_params_t* params, sin_cos_i_f effect_func) {
+RGB_MATRIX_RUNNER bool effect_runner_sin_cos_i(effect_params_t* params, sin_cos_i_f effect_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
     uint16_t time      = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 4);
@@ -26,15 +26,20 @@ static hsv_t SOLID_REACTIVE_CROSS_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_
     return hsv;
 }
 
+static int16_t SOLID_REACTIVE_CROSS_reach(uint16_t tick) {
+    // tick + dist has to stay below 255
+    return tick < 255 ? 254 - tick : -1;
+}
+
 #            ifdef ENABLE_RGB_MATRIX_SOLID_REACTIVE_CROSS
 bool SOLID_REACTIVE_CROSS(effect_params_t* params) {
-    return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_CROSS_math);
+    return effect_runner_reactive_splash_reach(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_CROSS_math, &SOLID_REACTIVE_CROSS_reach);
 }
 #            endif
 
 #            ifdef ENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTICROSS
 bool SOLID_REACTIVE_MULTICROSS(effect_params_t* params) {
-    return effect_runner_reactive_splash(0, params, &SOLID_REACTIVE_CROSS_math);
+    return effect_runner_reactive_splash_reach(0, params, &SOLID_REACTIVE_CROSS_math, &SOLID_REACTIVE_CROSS_reach);
 }
 #            endif
 
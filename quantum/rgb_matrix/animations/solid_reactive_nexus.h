@@ -26,12 +26,19 @@ static hsv_t SOLID_REACTIVE_NEXUS_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_
 }
 
 #            ifdef ENABLE_RGB_MATRIX_SOLID_REACTIVE_NEXUS
+static int16_t SOLID_REACTIVE_NEXUS_reach(uint16_t tick) {
+    // dist has to stay within 72, and below tick by less than 255
+    return tick < 72 + 255 ? (tick < 72 ? tick : 72) : -1;
+}
+
+// With only the one hit, skipping it leaves the LED dark whatever the hue would have been
 bool SOLID_REACTIVE_NEXUS(effect_params_t* params) {
-    return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_NEXUS_math);
+    return effect_runner_reactive_splash_reach(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_REACTIVE_NEXUS_math, &SOLID_REACTIVE_NEXUS_reach);
 }
 #            endif
 
 #            ifdef ENABLE_RGB_MATRIX_SOLID_REACTIVE_MULTINEXUS
+// The hue comes from the last hit, even one too far away to light the LED, so none can be skipped
 bool SOLID_REACTIVE_MULTINEXUS(effect_params_t* params) {
     return effect_runner_reactive_splash(0, params, &SOLID_REACTIVE_NEXUS_math);
 }
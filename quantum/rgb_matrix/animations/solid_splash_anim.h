@@ -18,15 +18,20 @@ hsv_t SOLID_SPLASH_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_
     return hsv;
 }
 
+int16_t SOLID_SPLASH_reach(uint16_t tick) {
+    // tick - dist has to stay below 255 and dist tops out at 255
+    return tick < 510 ? tick : -1;
+}
+
 #            ifdef ENABLE_RGB_MATRIX_SOLID_SPLASH
 bool SOLID_SPLASH(effect_params_t* params) {
-    return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_SPLASH_math);
+    return effect_runner_reactive_splash_reach(qsub8(g_last_hit_tracker.count, 1), params, &SOLID_SPLASH_math, &SOLID_SPLASH_reach);
 }
 #            endif
 
 #            ifdef ENABLE_RGB_MATRIX_SOLID_MULTISPLASH
 bool SOLID_MULTISPLASH(effect_params_t* params) {
-    return effect_runner_reactive_splash(0, params, &SOLID_SPLASH_math);
+    return effect_runner_reactive_splash_reach(0, params, &SOLID_SPLASH_math, &SOLID_SPLASH_reach);
 }
 #            endif
 
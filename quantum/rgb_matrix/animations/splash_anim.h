@@ -20,12 +20,19 @@ hsv_t SPLASH_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick
 }
 
 #            ifdef ENABLE_RGB_MATRIX_SPLASH
+int16_t SPLASH_reach(uint16_t tick) {
+    // tick - dist has to stay below 255 and dist tops out at 255
+    return tick < 510 ? tick : -1;
+}
+
+// With only the one hit, skipping it leaves the LED dark whatever the hue would have been
 bool SPLASH(effect_params_t* params) {
-    return effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), params, &SPLASH_math);
+    return effect_runner_reactive_splash_reach(qsub8(g_last_hit_tracker.count, 1), params, &SPLASH_math, &SPLASH_reach);
 }
 #            endif
 
 #            ifdef ENABLE_RGB_MATRIX_MULTISPLASH
+// Every hit shifts the hue, even those too far away to light the LED, so none can be skipped
 bool MULTISPLASH(effect_params_t* params) {
     return effect_runner_reactive_splash(0, params, &SPLASH_math);
 }
@@ -72,6 +72,7 @@ last_hit_t g_last_hit_tracker;
 
 // internals
 static bool            suspend_state     = false;
+static bool            idle_state        = false; // drivers are blanked and shut down
 static uint8_t         rgb_last_enable   = UINT8_MAX;
 static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
@@ -81,8 +82,28 @@ static rgb_task_states rgb_task_state    = SYNCING;
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 static last_hit_t last_hit_buffer;
+static uint8_t    last_hit_head; // slot of the oldest hit, last_hit_buffer is a ring
+
+static inline uint8_t last_hit_slot(uint8_t offset) {
+    uint8_t slot = last_hit_head + offset;
+    return slot < LED_HITS_TO_REMEMBER ? slot : slot - LED_HITS_TO_REMEMBER;
+}
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_FRAME_DIFF
+// colours of the frame being rendered, and of the one last flushed. Comparing the two at flush
+// time means an LED set to one colour and then back to the flushed one within a frame, such as
+// an indicator drawn over an effect, does not count as a change.
+static rgb_t                    frame_current[RGB_MATRIX_LED_COUNT];
+static rgb_t                    frame_flushed[RGB_MATRIX_LED_COUNT];
+static bool                     frame_flush_required = true;
+static rgb_matrix_frame_stats_t frame_stats;
+
+static inline void frame_update(uint8_t index, uint8_t red, uint8_t green, uint8_t blue) {
+    frame_current[index] = (rgb_t){.r = red, .g = green, .b = blue};
+}
+#endif // RGB_MATRIX_FRAME_DIFF
+
 // split rgb matrix
 #if defined(RGB_MATRIX_SPLIT)
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
@@ -140,8 +161,26 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
 }
 
 void rgb_matrix_update_pwm_buffers(void) {
+#ifdef RGB_MATRIX_FRAME_DIFF
+    if (!frame_flush_required && memcmp(frame_current, frame_flushed, sizeof(frame_flushed)) == 0) {
+        // nothing changed since the last flush
+        frame_stats.skipped_frames++;
+        return;
+    }
+    rgb_matrix_driver.flush();
+    memcpy(frame_flushed, frame_current, sizeof(frame_flushed));
+    frame_flush_required = false;
+    frame_stats.flushed_frames++;
+#else
     rgb_matrix_driver.flush();
+#endif
+}
+
+#ifdef RGB_MATRIX_FRAME_DIFF
+const rgb_matrix_frame_stats_t *rgb_matrix_get_frame_stats(void) {
+    return &frame_stats;
 }
+#endif
 
 __attribute__((weak)) int rgb_matrix_led_index(int index) {
 #if defined(RGB_MATRIX_SPLIT)
@@ -153,6 +192,11 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_FRAME_DIFF
+    if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
+        frame_update(index, red, green, blue);
+    }
+#endif
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
 }
 
@@ -161,6 +205,10 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
+#    ifdef RGB_MATRIX_FRAME_DIFF
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
+        frame_update(i, red, green, blue);
+#    endif
     rgb_matrix_driver.set_color_all(red, green, blue);
 #endif
 }
@@ -183,21 +231,20 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         led_count = rgb_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
+        uint8_t index;
+        if (last_hit_buffer.count < LED_HITS_TO_REMEMBER) {
+            index = last_hit_slot(last_hit_buffer.count);
+            last_hit_buffer.count++;
+        } else {
+            // Buffer is full, overwrite the oldest hit
+            index         = last_hit_head;
+            last_hit_head = last_hit_slot(1);
+        }
         last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
         last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
         last_hit_buffer.index[index] = led[i];
         last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
@@ -256,13 +303,13 @@ static void rgb_task_timers(void) {
 
     // Update double buffer last hit timers
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
-            last_hit_buffer.count--;
-            continue;
-        }
-        last_hit_buffer.tick[i] += deltaTime;
+    // All hits age together, so the ones about to expire are always the oldest
+    while (last_hit_buffer.count > 0 && UINT16_MAX - deltaTime < last_hit_buffer.tick[last_hit_head]) {
+        last_hit_head = last_hit_slot(1);
+        last_hit_buffer.count--;
+    }
+    for (uint8_t i = 0; i < last_hit_buffer.count; ++i) {
+        last_hit_buffer.tick[last_hit_slot(i)] += deltaTime;
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
@@ -280,7 +327,15 @@ static void rgb_task_start(void) {
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker = last_hit_buffer;
+    // unroll the ring so effects see hits oldest first
+    g_last_hit_tracker.count = last_hit_buffer.count;
+    for (uint8_t i = 0; i < last_hit_buffer.count; ++i) {
+        uint8_t slot                = last_hit_slot(i);
+        g_last_hit_tracker.x[i]     = last_hit_buffer.x[slot];
+        g_last_hit_tracker.y[i]     = last_hit_buffer.y[slot];
+        g_last_hit_tracker.index[i] = last_hit_buffer.index[slot];
+        g_last_hit_tracker.tick[i]  = last_hit_buffer.tick[slot];
+    }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
@@ -359,18 +414,57 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_task_state = SYNCING;
 }
 
+static void rgb_task_enter_idle(void) {
+    if (idle_state) {
+        return;
+    }
+
+    // blank the LEDs once, then stop talking to the drivers
+    rgb_matrix_set_color_all(0, 0, 0);
+    rgb_matrix_update_pwm_buffers();
+    if (rgb_matrix_driver.shutdown) {
+        rgb_matrix_driver.shutdown();
+    }
+
+    rgb_last_effect = 0;
+    idle_state      = true;
+}
+
+static void rgb_task_exit_idle(void) {
+    if (!idle_state) {
+        return;
+    }
+
+    if (rgb_matrix_driver.exit_shutdown) {
+        rgb_matrix_driver.exit_shutdown();
+    }
+#ifdef RGB_MATRIX_FRAME_DIFF
+    // the hardware may not have kept its state while shut down
+    frame_flush_required = true;
+#endif
+
+    // render a complete frame before the next flush
+    rgb_task_state = STARTING;
+    idle_state     = false;
+}
+
 void rgb_matrix_task(void) {
     rgb_task_timers();
 
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
 #if RGB_MATRIX_TIMEOUT > 0
                              (last_input_activity_elapsed() > (uint32_t)RGB_MATRIX_TIMEOUT) ||
 #endif // RGB_MATRIX_TIMEOUT > 0
                              false;
 
-    uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
+    // Nothing is rendered or flushed while idle, the drivers stay shut down until woken
+    if (suspend_backlight) {
+        rgb_task_enter_idle();
+        return;
+    }
+    rgb_task_exit_idle();
+
+    uint8_t effect = rgb_matrix_config.enable ? rgb_matrix_config.mode : 0;
 
     switch (rgb_task_state) {
         case STARTING:
@@ -462,6 +556,7 @@ void rgb_matrix_init(void) {
     }
 
     last_hit_buffer.count = 0;
+    last_hit_head         = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
         last_hit_buffer.tick[i] = UINT16_MAX;
     }
@@ -478,8 +573,7 @@ void rgb_matrix_init(void) {
 void rgb_matrix_set_suspend_state(bool state) {
 #ifdef RGB_MATRIX_SLEEP
     if (state && !suspend_state) { // only run if turning off, and only once
-        rgb_task_render(0);        // turn off all LEDs when suspending
-        rgb_task_flush(0);         // and actually flash led state to LEDs
+        rgb_task_enter_idle();     // turn off all LEDs and shut the drivers down
     }
     suspend_state = state;
 #endif
@@ -214,6 +214,15 @@ void        rgb_matrix_set_flags(led_flags_t flags);
 void        rgb_matrix_set_flags_noeeprom(led_flags_t flags);
 void        rgb_matrix_update_pwm_buffers(void);
 
+#ifdef RGB_MATRIX_FRAME_DIFF
+typedef struct {
+    uint32_t flushed_frames; // frames handed to the driver
+    uint32_t skipped_frames; // frames identical to the last flushed one
+} rgb_matrix_frame_stats_t;
+
+const rgb_matrix_frame_stats_t *rgb_matrix_get_frame_stats(void);
+#endif
+
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_update_rgb_matrix
 #    define rgblight_reload_from_eeprom rgb_matrix_reload_from_eeprom
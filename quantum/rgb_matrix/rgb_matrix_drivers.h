@@ -46,6 +46,10 @@ typedef struct {
     void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Put the hardware into a low power state while idle, optional. */
+    void (*shutdown)(void);
+    /* Bring the hardware back from the low power state, optional. */
+    void (*exit_shutdown)(void);
 } rgb_matrix_driver_t;
 
 extern const rgb_matrix_driver_t rgb_matrix_driver;
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 #include "color.h"
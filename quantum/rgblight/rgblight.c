@@ -178,7 +178,7 @@ void rgblight_check_config(void) {
 
 uint64_t eeconfig_read_rgblight(void) {
 #ifdef EEPROM_ENABLE
-    return (uint64_t)((eeprom_read_dword(EECONFIG_RGBLIGHT)) | ((uint64_t)eeprom_read_byte(EECONFIG_RGBLIGHT_EXTENDED) << 32));
+    return (uint64_t)((eeconfig_read_dword(EECONFIG_RGBLIGHT)) | ((uint64_t)eeconfig_read_byte(EECONFIG_RGBLIGHT_EXTENDED) << 32));
 #else
     return 0;
 #endif
@@ -187,8 +187,8 @@ uint64_t eeconfig_read_rgblight(void) {
 void eeconfig_update_rgblight(uint64_t val) {
 #ifdef EEPROM_ENABLE
     rgblight_check_config();
-    eeprom_update_dword(EECONFIG_RGBLIGHT, val & 0xFFFFFFFF);
-    eeprom_update_byte(EECONFIG_RGBLIGHT_EXTENDED, (val >> 32) & 0xFF);
+    eeconfig_update_dword(EECONFIG_RGBLIGHT, val & 0xFFFFFFFF);
+    eeconfig_update_byte(EECONFIG_RGBLIGHT_EXTENDED, (val >> 32) & 0xFF);
 #endif
 }
 
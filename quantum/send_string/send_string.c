@@ -22,8 +22,15 @@
 #include "quantum_keycodes.h"
 #include "keycode.h"
 #include "action.h"
+#include "action_util.h"
+#include "timer.h"
+#include "util.h"
 #include "wait.h"
 
+#if defined(SEND_STRING_ASYNC) && defined(UNICODE_COMMON_ENABLE) && defined(UNICODE_ASYNC)
+#    include "unicode.h"
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -146,11 +153,396 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+#ifdef SEND_STRING_COALESCE
+// The last key typed out is left held, and released in the report that presses the next one.
+static uint8_t send_string_held_key  = KC_NO;
+static uint8_t send_string_held_mods = 0;
+
+/**
+ * \brief Releases the key left held, in a report of its own.
+ *
+ * \return `false` if no key was held.
+ */
+static bool send_string_release_held(void) {
+    if (send_string_held_key == KC_NO) {
+        return false;
+    }
+    del_mods(send_string_held_mods);
+    unregister_code(send_string_held_key);
+    send_string_held_key  = KC_NO;
+    send_string_held_mods = 0;
+    return true;
+}
+
+/**
+ * \brief Whether a key can be pressed in the report that releases the one held.
+ *
+ * Keys with special handling in `register_code()` are left alone.
+ */
+static bool send_string_can_roll(uint8_t keycode) {
+    return IS_BASIC_KEYCODE(keycode) && !(keycode >= KC_LOCKING_CAPS_LOCK && keycode <= KC_LOCKING_SCROLL_LOCK);
+}
+
+/**
+ * \brief Presses a key and its modifiers in the report that releases the key held, and leaves it held.
+ *
+ * The same key has to be released in a report of its own first, to be typed twice.
+ */
+static void send_string_roll(uint8_t keycode, uint8_t mods) {
+    if (send_string_held_key != KC_NO) {
+        del_mods(send_string_held_mods);
+        del_key(send_string_held_key);
+    }
+    add_mods(mods);
+    register_code(keycode);
+    send_string_held_key  = keycode;
+    send_string_held_mods = mods;
+}
+#endif
+
+#if defined(SEND_STRING_ASYNC) || defined(SEND_STRING_COALESCE)
+static uint8_t send_string_char_mods(uint8_t ascii_code) {
+    return (PGM_LOADBIT(ascii_to_shift_lut, ascii_code) ? MOD_BIT(KC_LEFT_SHIFT) : 0) | (PGM_LOADBIT(ascii_to_altgr_lut, ascii_code) ? MOD_BIT(KC_RIGHT_ALT) : 0);
+}
+#endif
+
+#ifdef SEND_STRING_COALESCE
+/* Whether a character is typed out as a single key, which can be rolled over from the one before. */
+static bool send_string_char_rolls(uint8_t ascii_code) {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') {
+        return false;
+    }
+#    endif
+    return ascii_code < 128 && send_string_can_roll(pgm_read_byte(&ascii_to_keycode_lut[ascii_code])) && !PGM_LOADBIT(ascii_to_dead_lut, ascii_code);
+}
+#endif
+
+/* Releases the key left held by the character before, if there is one. */
+static void send_string_settle(uint8_t interval) {
+#ifdef SEND_STRING_COALESCE
+    if (send_string_release_held()) {
+        wait_ms(interval);
+    }
+#endif
+}
+
+/* Types out a key injected into a string. */
+static void send_string_tap_code(uint8_t keycode, uint8_t interval) {
+#ifdef SEND_STRING_COALESCE
+    if (send_string_can_roll(keycode)) {
+        if (keycode == send_string_held_key) {
+            send_string_settle(interval);
+        }
+        send_string_roll(keycode, 0);
+        return;
+    }
+#endif
+    send_string_settle(interval);
+    tap_code(keycode);
+}
+
+/* Types out a character of a string. */
+static void send_string_char_with_delay(char ascii_code, uint8_t interval) {
+#ifdef SEND_STRING_COALESCE
+    if (send_string_char_rolls(ascii_code)) {
+        uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+        if (keycode == send_string_held_key) {
+            send_string_settle(interval);
+        }
+        send_string_roll(keycode, send_string_char_mods(ascii_code));
+        wait_ms(interval);
+        return;
+    }
+#endif
+    send_string_settle(interval);
+    send_char_with_delay(ascii_code, interval);
+}
+
+#ifdef SEND_STRING_ASYNC
+_Static_assert(SEND_STRING_QUEUE_SIZE > 1 && SEND_STRING_QUEUE_SIZE < 256, "SEND_STRING_QUEUE_SIZE must be between 2 and 255");
+_Static_assert(SEND_STRING_DEFERRED_EVENTS > 0 && SEND_STRING_DEFERRED_EVENTS < 256, "SEND_STRING_DEFERRED_EVENTS must be between 1 and 255");
+
+enum {
+    send_string_op_char,
+    send_string_op_tap,
+    send_string_op_down,
+    send_string_op_up,
+    send_string_op_delay,
+    send_string_op_interval,
+};
+
+/* Strings are queued already parsed, as they may not outlive the call that queues them. */
+typedef struct {
+    uint8_t op;
+    uint8_t arg;
+} send_string_op_t;
+
+static send_string_op_t send_string_queue[SEND_STRING_QUEUE_SIZE];
+static uint8_t          send_string_queue_head      = 0;
+static uint8_t          send_string_queue_count     = 0;
+static uint8_t          send_string_queue_step      = 0; // reports already sent for the op at the head
+static uint8_t          send_string_interval        = 0;
+static uint8_t          send_string_queued_interval = 0;
+static uint32_t         send_string_next_report     = 0;
+
+/* Key events that came in while strings were queued, handled once they are typed out. */
+static keyrecord_t send_string_deferred[SEND_STRING_DEFERRED_EVENTS];
+static uint8_t     send_string_deferred_head  = 0;
+static uint8_t     send_string_deferred_count = 0;
+static bool        send_string_replaying      = false;
+
+static void send_string_queue_pop(void) {
+    send_string_queue_head = (send_string_queue_head + 1) % SEND_STRING_QUEUE_SIZE;
+    send_string_queue_count--;
+    send_string_queue_step = 0;
+}
+
+/**
+ * \brief Sends the next report of the op at the head of the queue, and pops it once it is done.
+ *
+ * \return `false` if the op sent no report.
+ */
+static bool send_string_queue_run(void) {
+    send_string_op_t op   = send_string_queue[send_string_queue_head];
+    uint8_t          step = send_string_queue_step++;
+    bool             done = true;
+    bool             sent = true;
+
+#    ifdef SEND_STRING_COALESCE
+    uint8_t roll_keycode = KC_NO;
+    uint8_t roll_mods    = 0;
+    if (op.op == send_string_op_char && send_string_char_rolls(op.arg)) {
+        roll_keycode = pgm_read_byte(&ascii_to_keycode_lut[op.arg]);
+        roll_mods    = send_string_char_mods(op.arg);
+    } else if (op.op == send_string_op_tap && send_string_can_roll(op.arg)) {
+        roll_keycode = op.arg;
+    }
+    // Anything that does not roll over, or the same key again, starts from a report with nothing held
+    if ((roll_keycode == KC_NO ? op.op != send_string_op_interval : roll_keycode == send_string_held_key) && send_string_release_held()) {
+        send_string_queue_step = 0;
+        return true;
+    }
+    if (roll_keycode != KC_NO) {
+        send_string_roll(roll_keycode, roll_mods);
+        send_string_queue_pop();
+        return true;
+    }
+#    endif
+
+    switch (op.op) {
+        case send_string_op_char: {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+            if (op.arg == '\a') { // BEL
+                PLAY_SONG(bell_song);
+                sent = false;
+                break;
+            }
+#    endif
+            uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[op.arg]);
+            uint8_t mods    = send_string_char_mods(op.arg);
+            if (keycode == KC_NO) {
+                sent = false;
+                break;
+            }
+            // The modifiers go out in the same report as the key, rather than in one of their own
+            switch (step) {
+                case 0:
+                    add_mods(mods);
+                    register_code(keycode);
+                    done = false;
+                    break;
+                case 1:
+                    del_mods(mods);
+                    unregister_code(keycode);
+                    done = !PGM_LOADBIT(ascii_to_dead_lut, op.arg);
+                    break;
+                case 2:
+                    register_code(KC_SPACE);
+                    done = false;
+                    break;
+                default:
+                    unregister_code(KC_SPACE);
+                    break;
+            }
+            break;
+        }
+        case send_string_op_tap:
+            if (step == 0) {
+                register_code(op.arg);
+                done = false;
+            } else {
+                unregister_code(op.arg);
+            }
+            break;
+        case send_string_op_down:
+            register_code(op.arg);
+            break;
+        case send_string_op_up:
+            unregister_code(op.arg);
+            break;
+        case send_string_op_delay:
+            send_string_next_report = timer_read32() + op.arg;
+            sent                    = false;
+            break;
+        case send_string_op_interval:
+            send_string_interval = op.arg;
+            sent                 = false;
+            break;
+    }
+
+    if (done) {
+        send_string_queue_pop();
+    }
+    return sent;
+}
+
+/* Handles the key events held back, in order, until one of them queues another string. */
+static void send_string_replay_deferred(void) {
+    send_string_replaying = true;
+    while (send_string_deferred_count && send_string_queue_empty()) {
+        keyrecord_t record        = send_string_deferred[send_string_deferred_head];
+        send_string_deferred_head = (send_string_deferred_head + 1) % SEND_STRING_DEFERRED_EVENTS;
+        send_string_deferred_count--;
+        process_record(&record);
+    }
+    send_string_replaying = false;
+}
+
+/* Sends the next report, if it is due. */
+static void send_string_queue_next(void) {
+    while (!send_string_queue_empty() && timer_expired32(timer_read32(), send_string_next_report)) {
+#    ifdef SEND_STRING_COALESCE
+        bool sent = send_string_queue_count ? send_string_queue_run() : send_string_release_held();
+#    else
+        bool sent = send_string_queue_run();
+#    endif
+        if (sent) {
+            send_string_next_report = timer_read32() + MAX(send_string_interval, SEND_STRING_QUEUE_INTERVAL);
+            break;
+        }
+    }
+}
+
+void send_string_task(void) {
+    send_string_queue_next();
+    send_string_replay_deferred();
+}
+
+bool send_string_queue_empty(void) {
+#    ifdef SEND_STRING_COALESCE
+    return !send_string_queue_count && send_string_held_key == KC_NO;
+#    else
+    return !send_string_queue_count;
+#    endif
+}
+
+/* Waits for the next report to be due, and sends it. */
+static void send_string_queue_run_blocking(void) {
+    uint32_t now = timer_read32();
+    if (!timer_expired32(now, send_string_next_report)) {
+        wait_ms(TIMER_DIFF_32(send_string_next_report, now));
+    }
+    send_string_queue_next();
+}
+
+void send_string_queue_flush(void) {
+    while (!send_string_queue_empty()) {
+        send_string_queue_run_blocking();
+    }
+}
+
+bool send_string_defer_record(keyrecord_t *record) {
+    // Events held back already go first, even once the strings before them are typed out
+    if (send_string_replaying || (send_string_queue_empty() && !send_string_deferred_count)) {
+        return false;
+    }
+    if (send_string_deferred_count == SEND_STRING_DEFERRED_EVENTS) {
+        // No room left, so catch up, blocking, and handle this one straight away
+        while (send_string_deferred_count) {
+            send_string_queue_flush();
+            send_string_replay_deferred();
+        }
+        send_string_queue_flush();
+        return false;
+    }
+    send_string_deferred[(send_string_deferred_head + send_string_deferred_count) % SEND_STRING_DEFERRED_EVENTS] = *record;
+    send_string_deferred_count++;
+    return true;
+}
+
+/* Queues an op, typing out what is already queued to make room if there is none. */
+static void send_string_enqueue(uint8_t op, uint8_t arg) {
+#    if defined(UNICODE_COMMON_ENABLE) && defined(UNICODE_ASYNC)
+    // Code points are typed out from a queue of their own, so let them go first
+    unicode_queue_flush();
+#    endif
+    while (send_string_queue_count == SEND_STRING_QUEUE_SIZE) {
+        send_string_queue_run_blocking();
+    }
+    send_string_queue[(send_string_queue_head + send_string_queue_count) % SEND_STRING_QUEUE_SIZE] = (send_string_op_t){op, arg};
+    send_string_queue_count++;
+}
+
+static void send_string_enqueue_interval(uint8_t interval) {
+    if (interval != send_string_queued_interval) {
+        send_string_enqueue(send_string_op_interval, interval);
+        send_string_queued_interval = interval;
+    }
+}
+
+static char send_string_read(const char *string, bool progmem) {
+    return progmem ? pgm_read_byte(string) : *string;
+}
+
+static void send_string_enqueue_string(const char *string, uint8_t interval, bool progmem) {
+    send_string_enqueue_interval(interval);
+    while (1) {
+        char ascii_code = send_string_read(string, progmem);
+        if (!ascii_code) break;
+        if (ascii_code == SS_QMK_PREFIX) {
+            ascii_code = send_string_read(++string, progmem);
+
+            if (ascii_code == SS_TAP_CODE) {
+                send_string_enqueue(send_string_op_tap, send_string_read(++string, progmem));
+            } else if (ascii_code == SS_DOWN_CODE) {
+                send_string_enqueue(send_string_op_down, send_string_read(++string, progmem));
+            } else if (ascii_code == SS_UP_CODE) {
+                send_string_enqueue(send_string_op_up, send_string_read(++string, progmem));
+            } else if (ascii_code == SS_DELAY_CODE) {
+                int     ms      = 0;
+                uint8_t keycode = send_string_read(++string, progmem);
+
+                while (isdigit(keycode)) {
+                    ms *= 10;
+                    ms += keycode - '0';
+                    keycode = send_string_read(++string, progmem);
+                }
+
+                while (ms > 0) {
+                    uint8_t chunk = MIN(ms, UINT8_MAX);
+                    send_string_enqueue(send_string_op_delay, chunk);
+                    ms -= chunk;
+                }
+            }
+        } else if ((uint8_t)ascii_code < 128) {
+            send_string_enqueue(send_string_op_char, ascii_code);
+        }
+
+        ++string;
+    }
+}
+#endif
+
 void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
 
 void send_string_with_delay(const char *string, uint8_t interval) {
+#ifdef SEND_STRING_ASYNC
+    send_string_enqueue_string(string, interval, false);
+    return;
+#endif
     while (1) {
         char ascii_code = *string;
         if (!ascii_code) break;
@@ -160,14 +552,16 @@ void send_string_with_delay(const char *string, uint8_t interval) {
             if (ascii_code == SS_TAP_CODE) {
                 // tap
                 uint8_t keycode = *(++string);
-                tap_code(keycode);
+                send_string_tap_code(keycode, interval);
             } else if (ascii_code == SS_DOWN_CODE) {
                 // down
                 uint8_t keycode = *(++string);
+                send_string_settle(interval);
                 register_code(keycode);
             } else if (ascii_code == SS_UP_CODE) {
                 // up
                 uint8_t keycode = *(++string);
+                send_string_settle(interval);
                 unregister_code(keycode);
             } else if (ascii_code == SS_DELAY_CODE) {
                 // delay
@@ -180,16 +574,18 @@ void send_string_with_delay(const char *string, uint8_t interval) {
                     keycode = *(++string);
                 }
 
+                send_string_settle(interval);
                 wait_ms(ms);
             }
 
             wait_ms(interval);
         } else {
-            send_char_with_delay(ascii_code, interval);
+            send_string_char_with_delay(ascii_code, interval);
         }
 
         ++string;
     }
+    send_string_settle(interval);
 }
 
 void send_char(char ascii_code) {
@@ -197,6 +593,14 @@ void send_char(char ascii_code) {
 }
 
 void send_char_with_delay(char ascii_code, uint8_t interval) {
+#ifdef SEND_STRING_ASYNC
+    if ((uint8_t)ascii_code < 128) {
+        send_string_enqueue_interval(interval);
+        send_string_enqueue(send_string_op_char, ascii_code);
+    }
+    return;
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
     if (ascii_code == '\a') { // BEL
         PLAY_SONG(bell_song);
@@ -298,6 +702,10 @@ void send_string_P(const char *string) {
 }
 
 void send_string_with_delay_P(const char *string, uint8_t interval) {
+#    ifdef SEND_STRING_ASYNC
+    send_string_enqueue_string(string, interval, true);
+    return;
+#    endif
     while (1) {
         char ascii_code = pgm_read_byte(string);
         if (!ascii_code) break;
@@ -307,14 +715,16 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
             if (ascii_code == SS_TAP_CODE) {
                 // tap
                 uint8_t keycode = pgm_read_byte(++string);
-                tap_code(keycode);
+                send_string_tap_code(keycode, interval);
             } else if (ascii_code == SS_DOWN_CODE) {
                 // down
                 uint8_t keycode = pgm_read_byte(++string);
+                send_string_settle(interval);
                 register_code(keycode);
             } else if (ascii_code == SS_UP_CODE) {
                 // up
                 uint8_t keycode = pgm_read_byte(++string);
+                send_string_settle(interval);
                 unregister_code(keycode);
             } else if (ascii_code == SS_DELAY_CODE) {
                 // delay
@@ -326,13 +736,15 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
                     ms += keycode - '0';
                     keycode = pgm_read_byte(++string);
                 }
+                send_string_settle(interval);
                 wait_ms(ms);
             }
         } else {
-            send_char_with_delay(ascii_code, interval);
+            send_string_char_with_delay(ascii_code, interval);
         }
 
         ++string;
     }
+    send_string_settle(interval);
 }
 #endif
@@ -24,10 +24,25 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
 
+#ifdef SEND_STRING_ASYNC
+#    ifndef SEND_STRING_QUEUE_SIZE
+#        define SEND_STRING_QUEUE_SIZE 64
+#    endif
+#    ifndef SEND_STRING_QUEUE_INTERVAL
+#        define SEND_STRING_QUEUE_INTERVAL 1
+#    endif
+#    ifndef SEND_STRING_DEFERRED_EVENTS
+#        define SEND_STRING_DEFERRED_EVENTS 8
+#    endif
+
+#    include "action.h"
+#endif
+
 // Look-Up Tables (LUTs) to convert ASCII character to keycode sequence.
 extern const uint8_t ascii_to_shift_lut[16];
 extern const uint8_t ascii_to_altgr_lut[16];
@@ -123,6 +138,39 @@ void send_nibble(uint8_t number);
  */
 void tap_random_base64(void);
 
+#if defined(SEND_STRING_ASYNC) || defined(__DOXYGEN__)
+/**
+ * \brief Type out the next report of the queued strings, once the report interval is up.
+ *
+ * With `SEND_STRING_ASYNC` defined, the functions above only queue what they are given, and this
+ * types it out from the main loop without blocking.
+ */
+void send_string_task(void);
+
+/**
+ * \brief Whether everything queued has been typed out.
+ */
+bool send_string_queue_empty(void);
+
+/**
+ * \brief Type out everything queued, blocking until it is done.
+ *
+ * Needed before sending keys some other way, such as with `tap_code()`, that have to come after the
+ * queued strings.
+ */
+void send_string_queue_flush(void);
+
+/**
+ * \brief Hold back a key event until the queued strings are typed out.
+ *
+ * Called by QMK core before handling a key event, so that the keys it sends reach the host after
+ * the strings queued before it, without blocking the main loop.
+ *
+ * \return `true` if the event was held back, and is to be handled later.
+ */
+bool send_string_defer_record(keyrecord_t *record);
+#endif
+
 #if defined(__AVR__) || defined(__DOXYGEN__)
 /**
  * \brief Type out a PROGMEM string of ASCII characters.
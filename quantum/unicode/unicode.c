@@ -23,6 +23,8 @@
 #include "host.h"
 #include "keycode.h"
 #include "wait.h"
+#include "timer.h"
+#include "progmem.h"
 #include "send_string.h"
 #include "utf8.h"
 #include "debug.h"
@@ -63,6 +65,17 @@
 #    define UNICODE_TYPE_DELAY 10
 #endif
 
+#ifdef UNICODE_ASYNC
+// Number of keystroke steps that can be queued
+#    ifndef UNICODE_QUEUE_SIZE
+#        define UNICODE_QUEUE_SIZE 48
+#    endif
+// Minimum time between two reports typed out from the queue, in ms
+#    ifndef UNICODE_QUEUE_INTERVAL
+#        define UNICODE_QUEUE_INTERVAL 1
+#    endif
+#endif
+
 unicode_config_t unicode_config;
 uint8_t          unicode_saved_mods;
 led_t            unicode_saved_led_state;
@@ -136,7 +149,7 @@ static void unicode_play_song(uint8_t mode) {
 #endif
 
 void unicode_input_mode_init(void) {
-    unicode_config.raw = eeprom_read_byte(EECONFIG_UNICODEMODE);
+    unicode_config.raw = eeconfig_read_byte(EECONFIG_UNICODEMODE);
 #if UNICODE_SELECTED_MODES != -1
 #    if UNICODE_CYCLE_PERSIST
     // Find input_mode in selected modes
@@ -165,7 +178,7 @@ uint8_t get_unicode_input_mode(void) {
 }
 
 static void persist_unicode_input_mode(void) {
-    eeprom_update_byte(EECONFIG_UNICODEMODE, unicode_config.input_mode);
+    eeconfig_update_byte(EECONFIG_UNICODEMODE, unicode_config.input_mode);
 }
 
 void set_unicode_input_mode(uint8_t mode) {
@@ -209,6 +222,9 @@ void unicode_input_mode_step_reverse(void) {
 }
 
 __attribute__((weak)) void unicode_input_start(void) {
+#ifdef SEND_STRING_ASYNC
+    send_string_queue_flush();
+#endif
     unicode_saved_led_state = host_keyboard_led_state();
 
     // Note the order matters here!
@@ -321,6 +337,10 @@ static void send_nibble_wrapper(uint8_t digit) {
         return;
     }
     send_nibble(digit);
+#ifdef SEND_STRING_ASYNC
+    // The input sequence around the digit is not queued
+    send_string_queue_flush();
+#endif
 }
 
 // clang-format on
@@ -332,7 +352,8 @@ void register_hex(uint16_t hex) {
     }
 }
 
-void register_hex32(uint32_t hex) {
+/* Sends the digits of a code point the way the input mode expects them. */
+static void unicode_hex32_digits(uint32_t hex, void (*send_digit)(uint8_t digit)) {
     bool first_digit        = true;
     bool needs_leading_zero = (unicode_config.input_mode == UNICODE_MODE_WINCOMPOSE);
     for (int i = 7; i >= 0; i--) {
@@ -342,7 +363,7 @@ void register_hex32(uint32_t hex) {
         // If we're still searching for the first digit, and found one
         // that needs a leading zero sent out, send the zero.
         if (first_digit && needs_leading_zero && digit > 9) {
-            send_nibble_wrapper(0);
+            send_digit(0);
         }
 
         // Always send digits (including zero) if we're down to the last
@@ -351,29 +372,296 @@ void register_hex32(uint32_t hex) {
 
         // If we've found a digit worth transmitting, do so.
         if (digit != 0 || !first_digit || must_send) {
-            send_nibble_wrapper(digit);
+            send_digit(digit);
             first_digit = false;
         }
     }
 }
 
+void register_hex32(uint32_t hex) {
+    unicode_hex32_digits(hex, send_nibble_wrapper);
+}
+
+#ifdef UNICODE_ASYNC
+enum {
+    unicode_step_press,
+    unicode_step_release,
+    unicode_step_wait,
+    unicode_step_save_leds,
+    unicode_step_save_mods,
+    unicode_step_restore_mods,
+    unicode_step_skip_unless_caps_lock, // skips the next `keycode` steps unless Caps Lock was on
+    unicode_step_skip_if_num_lock,      // skips the next `keycode` steps if Num Lock was on
+};
+
+typedef struct {
+    uint8_t  step;
+    uint16_t keycode;
+} unicode_step_t;
+
+#    define UNICODE_TAP(keycode) {unicode_step_press, (keycode)}, {unicode_step_release, (keycode)}
+
+// clang-format off
+
+/* The keystrokes of unicode_input_start() and unicode_input_finish() for each input mode, worked
+ * out ahead of time. Host LED states are only known once the sequence is typed out. */
+static const unicode_step_t unicode_start_macos[] PROGMEM = {
+    {unicode_step_save_leds}, {unicode_step_save_mods},
+    {unicode_step_press, UNICODE_KEY_MAC},
+    {unicode_step_wait, UNICODE_TYPE_DELAY},
+};
+static const unicode_step_t unicode_finish_macos[] PROGMEM = {
+    {unicode_step_release, UNICODE_KEY_MAC},
+    {unicode_step_restore_mods},
+};
+static const unicode_step_t unicode_start_linux[] PROGMEM = {
+    {unicode_step_save_leds},
+    // Caps Lock goes off before the mods are cleared, see unicode_input_start()
+    {unicode_step_skip_unless_caps_lock, 2}, UNICODE_TAP(KC_CAPS_LOCK),
+    {unicode_step_save_mods},
+    UNICODE_TAP(UNICODE_KEY_LNX),
+    {unicode_step_wait, UNICODE_TYPE_DELAY},
+};
+static const unicode_step_t unicode_finish_linux[] PROGMEM = {
+    UNICODE_TAP(KC_SPACE),
+    {unicode_step_skip_unless_caps_lock, 2}, UNICODE_TAP(KC_CAPS_LOCK),
+    {unicode_step_restore_mods},
+};
+static const unicode_step_t unicode_start_windows[] PROGMEM = {
+    {unicode_step_save_leds}, {unicode_step_save_mods},
+    {unicode_step_skip_if_num_lock, 2}, UNICODE_TAP(KC_NUM_LOCK),
+    {unicode_step_press, KC_LEFT_ALT},
+    {unicode_step_wait, UNICODE_TYPE_DELAY},
+    UNICODE_TAP(KC_KP_PLUS),
+    {unicode_step_wait, UNICODE_TYPE_DELAY},
+};
+static const unicode_step_t unicode_finish_windows[] PROGMEM = {
+    {unicode_step_release, KC_LEFT_ALT},
+    {unicode_step_skip_if_num_lock, 2}, UNICODE_TAP(KC_NUM_LOCK),
+    {unicode_step_restore_mods},
+};
+static const unicode_step_t unicode_start_bsd[] PROGMEM = {
+    {unicode_step_save_leds}, {unicode_step_save_mods},
+    {unicode_step_wait, UNICODE_TYPE_DELAY},
+};
+static const unicode_step_t unicode_finish_bsd[] PROGMEM = {
+    {unicode_step_restore_mods},
+};
+static const unicode_step_t unicode_start_wincompose[] PROGMEM = {
+    {unicode_step_save_leds}, {unicode_step_save_mods},
+    UNICODE_TAP(UNICODE_KEY_WINC),
+    UNICODE_TAP(KC_U),
+    {unicode_step_wait, UNICODE_TYPE_DELAY},
+};
+static const unicode_step_t unicode_finish_wincompose[] PROGMEM = {
+    UNICODE_TAP(KC_ENTER),
+    {unicode_step_restore_mods},
+};
+static const unicode_step_t unicode_start_emacs[] PROGMEM = {
+    {unicode_step_save_leds}, {unicode_step_save_mods},
+    UNICODE_TAP(LCTL(KC_X)),
+    UNICODE_TAP(KC_8),
+    UNICODE_TAP(KC_ENTER),
+    {unicode_step_wait, UNICODE_TYPE_DELAY},
+};
+static const unicode_step_t unicode_finish_emacs[] PROGMEM = {
+    UNICODE_TAP(KC_ENTER),
+    {unicode_step_restore_mods},
+};
+
+// clang-format on
+
+_Static_assert(UNICODE_QUEUE_SIZE >= ARRAY_SIZE(unicode_start_linux) && UNICODE_QUEUE_SIZE < 256, "UNICODE_QUEUE_SIZE must fit the longest start sequence, and be less than 256");
+
+static unicode_step_t unicode_queue[UNICODE_QUEUE_SIZE];
+static uint8_t        unicode_queue_head  = 0;
+static uint8_t        unicode_queue_count = 0;
+static uint32_t       unicode_next_step   = 0;
+
+static unicode_step_t unicode_queue_pop(void) {
+    unicode_step_t step = unicode_queue[unicode_queue_head];
+    unicode_queue_head  = (unicode_queue_head + 1) % UNICODE_QUEUE_SIZE;
+    unicode_queue_count--;
+    return step;
+}
+
+void unicode_task(void) {
+    while (unicode_queue_count && timer_expired32(timer_read32(), unicode_next_step)) {
+        unicode_step_t step = unicode_queue_pop();
+        switch (step.step) {
+            case unicode_step_press:
+                register_code16(step.keycode);
+                unicode_next_step = timer_read32() + UNICODE_QUEUE_INTERVAL;
+                return;
+            case unicode_step_release:
+                unregister_code16(step.keycode);
+                unicode_next_step = timer_read32() + UNICODE_QUEUE_INTERVAL;
+                return;
+            case unicode_step_wait:
+                unicode_next_step = timer_read32() + step.keycode;
+                break;
+            case unicode_step_save_leds:
+                unicode_saved_led_state = host_keyboard_led_state();
+                break;
+            case unicode_step_save_mods:
+                unicode_saved_mods = get_mods();
+                clear_mods();
+                clear_weak_mods();
+                break;
+            case unicode_step_restore_mods:
+                set_mods(unicode_saved_mods);
+                break;
+            case unicode_step_skip_unless_caps_lock:
+            case unicode_step_skip_if_num_lock:
+                if (step.step == unicode_step_skip_unless_caps_lock ? !unicode_saved_led_state.caps_lock : unicode_saved_led_state.num_lock) {
+                    for (uint8_t i = 0; i < step.keycode; i++) {
+                        unicode_queue_pop();
+                    }
+                }
+                break;
+        }
+    }
+}
+
+bool unicode_queue_empty(void) {
+    return !unicode_queue_count;
+}
+
+/* Waits for the next step to be due, and runs it. */
+static void unicode_queue_run_blocking(void) {
+    uint32_t now = timer_read32();
+    if (!timer_expired32(now, unicode_next_step)) {
+        wait_ms(TIMER_DIFF_32(unicode_next_step, now));
+    }
+    unicode_task();
+}
+
+void unicode_queue_flush(void) {
+    while (unicode_queue_count) {
+        unicode_queue_run_blocking();
+    }
+}
+
+/* Queues steps from RAM or PROGMEM, typing out what is already queued to make room for all of them
+ * at once, as skips reach past the step they are in. */
+static void unicode_enqueue(const unicode_step_t *steps, uint8_t count, bool progmem) {
+#    ifdef SEND_STRING_ASYNC
+    // Strings are typed out from a queue of their own, so let them go first
+    send_string_queue_flush();
+#    endif
+    while (UNICODE_QUEUE_SIZE - unicode_queue_count < count) {
+        unicode_queue_run_blocking();
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        unicode_step_t *slot = &unicode_queue[(unicode_queue_head + unicode_queue_count) % UNICODE_QUEUE_SIZE];
+        if (progmem) {
+            memcpy_P(slot, &steps[i], sizeof(unicode_step_t));
+        } else {
+            *slot = steps[i];
+        }
+        unicode_queue_count++;
+    }
+}
+
+#    define UNICODE_ENQUEUE_P(steps) unicode_enqueue((steps), ARRAY_SIZE(steps), true)
+
+static void unicode_enqueue_start(void) {
+    switch (unicode_config.input_mode) {
+        case UNICODE_MODE_MACOS:
+            UNICODE_ENQUEUE_P(unicode_start_macos);
+            break;
+        case UNICODE_MODE_LINUX:
+            UNICODE_ENQUEUE_P(unicode_start_linux);
+            break;
+        case UNICODE_MODE_WINDOWS:
+            UNICODE_ENQUEUE_P(unicode_start_windows);
+            break;
+        case UNICODE_MODE_BSD:
+            UNICODE_ENQUEUE_P(unicode_start_bsd);
+            break;
+        case UNICODE_MODE_WINCOMPOSE:
+            UNICODE_ENQUEUE_P(unicode_start_wincompose);
+            break;
+        case UNICODE_MODE_EMACS:
+            UNICODE_ENQUEUE_P(unicode_start_emacs);
+            break;
+    }
+}
+
+static void unicode_enqueue_finish(void) {
+    switch (unicode_config.input_mode) {
+        case UNICODE_MODE_MACOS:
+            UNICODE_ENQUEUE_P(unicode_finish_macos);
+            break;
+        case UNICODE_MODE_LINUX:
+            UNICODE_ENQUEUE_P(unicode_finish_linux);
+            break;
+        case UNICODE_MODE_WINDOWS:
+            UNICODE_ENQUEUE_P(unicode_finish_windows);
+            break;
+        case UNICODE_MODE_BSD:
+            UNICODE_ENQUEUE_P(unicode_finish_bsd);
+            break;
+        case UNICODE_MODE_WINCOMPOSE:
+            UNICODE_ENQUEUE_P(unicode_finish_wincompose);
+            break;
+        case UNICODE_MODE_EMACS:
+            UNICODE_ENQUEUE_P(unicode_finish_emacs);
+            break;
+    }
+}
+
+// clang-format off
+
+/* Queues a tap of the key send_nibble_wrapper() would send for a digit. */
+static void unicode_enqueue_digit(uint8_t digit) {
+    uint16_t keycode;
+    if (unicode_config.input_mode == UNICODE_MODE_WINDOWS) {
+        keycode = digit < 10
+                ? KC_KP_1 + (10 + digit - 1) % 10
+                : KC_A + (digit - 10);
+    } else {
+        uint8_t ascii_code = digit < 10 ? '0' + digit : 'a' + digit - 10;
+        keycode = pgm_read_byte(&ascii_to_keycode_lut[ascii_code]);
+        if ((pgm_read_byte(&ascii_to_shift_lut[ascii_code / 8]) >> (ascii_code % 8)) & 1) {
+            keycode = LSFT(keycode);
+        }
+    }
+    unicode_step_t tap[] = {UNICODE_TAP(keycode)};
+    unicode_enqueue(tap, ARRAY_SIZE(tap), false);
+}
+
+// clang-format on
+#endif
+
 void register_unicode(uint32_t code_point) {
     if (code_point > 0x10FFFF || (code_point > 0xFFFF && unicode_config.input_mode == UNICODE_MODE_WINDOWS)) {
         // Code point out of range, do nothing
         return;
     }
 
+#ifdef UNICODE_ASYNC
+    // Only queued here, and typed out by unicode_task()
+    void (*send_digit)(uint8_t) = unicode_enqueue_digit;
+    unicode_enqueue_start();
+#else
+    void (*send_digit)(uint8_t) = send_nibble_wrapper;
     unicode_input_start();
+#endif
     if (code_point > 0xFFFF && unicode_config.input_mode == UNICODE_MODE_MACOS) {
         // Convert code point to UTF-16 surrogate pair on macOS
         code_point -= 0x10000;
         uint32_t lo = code_point & 0x3FF, hi = (code_point & 0xFFC00) >> 10;
-        register_hex32(hi + 0xD800);
-        register_hex32(lo + 0xDC00);
+        unicode_hex32_digits(hi + 0xD800, send_digit);
+        unicode_hex32_digits(lo + 0xDC00, send_digit);
     } else {
-        register_hex32(code_point);
+        unicode_hex32_digits(code_point, send_digit);
     }
+#ifdef UNICODE_ASYNC
+    unicode_enqueue_finish();
+#else
     unicode_input_finish();
+#endif
 }
 
 void send_unicode_string(const char *str) {
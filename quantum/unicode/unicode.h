@@ -17,6 +17,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "unicode_keycodes.h"
 
 /**
@@ -131,4 +132,24 @@ void register_unicode(uint32_t code_point);
  */
 void send_unicode_string(const char *str);
 
+#if defined(UNICODE_ASYNC) || defined(__DOXYGEN__)
+/**
+ * \brief Type out the next step of the queued code points, once it is due.
+ *
+ * With `UNICODE_ASYNC` defined, `register_unicode()` only queues the keystrokes for a code point,
+ * and this types them out from the main loop without blocking.
+ */
+void unicode_task(void);
+
+/**
+ * \brief Whether every queued code point has been typed out.
+ */
+bool unicode_queue_empty(void);
+
+/**
+ * \brief Type out every queued code point, blocking until it is done.
+ */
+void unicode_queue_flush(void);
+#endif
+
 /** \} */
@@ -24,6 +24,7 @@
 
 #include "via.h"
 
+#include <string.h>
 #include "raw_hid.h"
 #include "dynamic_keymap.h"
 #include "eeprom.h"
@@ -32,6 +33,7 @@
 #include "timer.h"
 #include "wait.h"
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
+#include "util.h"
 
 #if defined(AUDIO_ENABLE)
 #    include "audio.h"
@@ -57,6 +59,10 @@
 #    include "led_matrix.h"
 #endif
 
+#if defined(ADAPTIVE_TAPPING_TERM_ENABLE)
+#    include "process_adaptive_tapping_term.h"
+#endif
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void) {
@@ -269,6 +275,206 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
     via_custom_value_command_kb(data, length);
 }
 
+#if defined(VIA_BULK_TRANSFER_ENABLE)
+// Size of the buffer reads are staged into ahead of being sent, and writes are
+// collected in before being written, so EEPROM is accessed in blocks.
+#    ifndef VIA_BULK_STAGING_SIZE
+#        define VIA_BULK_STAGING_SIZE (VIA_BULK_PAYLOAD_SIZE * 4)
+#    endif
+
+// Number of data reports sent by each via_task() call while streaming a read.
+#    ifndef VIA_BULK_REPORTS_PER_TASK
+#        define VIA_BULK_REPORTS_PER_TASK 4
+#    endif
+
+#    define VIA_BULK_REPORT_SIZE 32
+
+enum via_bulk_state {
+    VIA_BULK_IDLE,
+    VIA_BULK_READING,
+    VIA_BULK_WRITING,
+};
+
+static struct {
+    uint8_t  state;
+    uint8_t  region;
+    uint8_t  sequence;
+    uint16_t crc;
+    uint16_t offset;    // Region offset of the next block read into, or written from, staging
+    uint16_t remaining; // Bytes still to be sent, or received
+    uint16_t staged;    // Bytes held in staging
+    uint16_t position;  // Bytes of staging already sent
+    bool     written;   // Part of the range has been written to EEPROM
+    uint8_t  staging[VIA_BULK_STAGING_SIZE];
+} via_bulk;
+
+// CRC-16/CCITT-FALSE, polynomial 0x1021, initial value 0xFFFF
+static uint16_t via_bulk_crc16(uint16_t crc, const uint8_t *data, uint16_t length) {
+    while (length--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (uint8_t i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static uint16_t via_bulk_region_size(uint8_t region) {
+    switch (region) {
+        case id_bulk_region_keymap:
+            return dynamic_keymap_get_layer_count() * MATRIX_ROWS * MATRIX_COLS * 2;
+        case id_bulk_region_macro:
+            return dynamic_keymap_macro_get_buffer_size();
+        default:
+            return 0;
+    }
+}
+
+static void via_bulk_region_read(uint16_t offset, uint16_t size, uint8_t *data) {
+    if (via_bulk.region == id_bulk_region_keymap) {
+        dynamic_keymap_get_buffer(offset, size, data);
+    } else {
+        dynamic_keymap_macro_get_buffer(offset, size, data);
+    }
+}
+
+static void via_bulk_region_write(uint16_t offset, uint16_t size, uint8_t *data) {
+    if (via_bulk.region == id_bulk_region_keymap) {
+        dynamic_keymap_set_buffer(offset, size, data);
+    } else {
+        dynamic_keymap_macro_set_buffer(offset, size, data);
+    }
+}
+
+static void via_bulk_write_staged(void) {
+    if (via_bulk.staged > 0) {
+        via_bulk_region_write(via_bulk.offset, via_bulk.staged, via_bulk.staging);
+        via_bulk.offset += via_bulk.staged;
+        via_bulk.staged  = 0;
+        via_bulk.written = true;
+    }
+}
+
+// Returns the status of a failed write, telling the host when the range has to be written again.
+static uint8_t via_bulk_write_error(uint8_t status) {
+    return via_bulk.written ? status | id_bulk_status_resend_range : status;
+}
+
+static void via_bulk_send_end(uint8_t status) {
+    uint8_t report[VIA_BULK_REPORT_SIZE] = {VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_end, via_bulk.sequence, via_bulk.crc >> 8, via_bulk.crc & 0xFF, status};
+    raw_hid_send(report, sizeof(report));
+}
+
+// Handles a bulk transfer report, returning false if no response is to be sent.
+static bool via_bulk_transfer_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, op, ... ]
+    uint8_t *command_id   = &(data[0]);
+    uint8_t *command_data = &(data[1]);
+
+    switch (command_data[0]) {
+        case id_bulk_read_start:
+        case id_bulk_write_start: {
+            uint8_t  region = command_data[1];
+            uint16_t offset = (command_data[2] << 8) | command_data[3];
+            uint16_t size   = (command_data[4] << 8) | command_data[5];
+
+            // Anything already in progress is abandoned
+            via_bulk.state = VIA_BULK_IDLE;
+            if (size == 0 || (uint32_t)offset + size > via_bulk_region_size(region)) {
+                command_data[6] = id_bulk_status_invalid;
+                break;
+            }
+            via_bulk.state     = command_data[0] == id_bulk_read_start ? VIA_BULK_READING : VIA_BULK_WRITING;
+            via_bulk.region    = region;
+            via_bulk.sequence  = 0;
+            via_bulk.crc       = 0xFFFF;
+            via_bulk.offset    = offset;
+            via_bulk.remaining = size;
+            via_bulk.staged    = 0;
+            via_bulk.position  = 0;
+            via_bulk.written   = false;
+            command_data[6]    = id_bulk_status_ok;
+            break;
+        }
+        case id_bulk_data: {
+            if (via_bulk.state != VIA_BULK_WRITING) {
+                command_data[0] = id_bulk_end;
+                command_data[4] = id_bulk_status_invalid;
+                break;
+            }
+            if (command_data[1] != via_bulk.sequence) {
+                via_bulk.state = VIA_BULK_IDLE;
+                via_bulk_send_end(via_bulk_write_error(id_bulk_status_sequence_error));
+                return false;
+            }
+
+            uint8_t size = MIN(via_bulk.remaining, VIA_BULK_PAYLOAD_SIZE);
+            if (size > VIA_BULK_STAGING_SIZE - via_bulk.staged) {
+                via_bulk_write_staged();
+            }
+            memcpy(&via_bulk.staging[via_bulk.staged], &command_data[2], size);
+            via_bulk.staged += size;
+            via_bulk.remaining -= size;
+            via_bulk.crc = via_bulk_crc16(via_bulk.crc, &command_data[2], size);
+            via_bulk.sequence++;
+            if (via_bulk.remaining == 0) {
+                via_bulk_write_staged();
+            }
+            // Data reports are not acknowledged, so the host can keep sending
+            return false;
+        }
+        case id_bulk_end: {
+            if (via_bulk.state != VIA_BULK_WRITING) {
+                command_data[4] = id_bulk_status_invalid;
+                break;
+            }
+            uint16_t crc   = (command_data[2] << 8) | command_data[3];
+            via_bulk.state = VIA_BULK_IDLE;
+            if (command_data[1] != via_bulk.sequence || via_bulk.remaining != 0) {
+                command_data[4] = via_bulk_write_error(id_bulk_status_sequence_error);
+            } else if (crc != via_bulk.crc) {
+                command_data[4] = via_bulk_write_error(id_bulk_status_checksum_error);
+            } else {
+                command_data[4] = id_bulk_status_ok;
+            }
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+    return true;
+}
+
+// Sends the next few data reports of a bulk read, reading EEPROM ahead a staging buffer at a time.
+void via_task(void) {
+    for (uint8_t i = 0; i < VIA_BULK_REPORTS_PER_TASK && via_bulk.state == VIA_BULK_READING; i++) {
+        if (via_bulk.position == via_bulk.staged) {
+            via_bulk.staged   = MIN(via_bulk.remaining, VIA_BULK_STAGING_SIZE);
+            via_bulk.position = 0;
+            via_bulk_region_read(via_bulk.offset, via_bulk.staged, via_bulk.staging);
+            via_bulk.offset += via_bulk.staged;
+        }
+
+        uint8_t report[VIA_BULK_REPORT_SIZE] = {VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_data, via_bulk.sequence};
+        uint8_t size                         = MIN(via_bulk.staged - via_bulk.position, VIA_BULK_PAYLOAD_SIZE);
+        memcpy(&report[3], &via_bulk.staging[via_bulk.position], size);
+        raw_hid_send(report, sizeof(report));
+
+        via_bulk.crc = via_bulk_crc16(via_bulk.crc, &via_bulk.staging[via_bulk.position], size);
+        via_bulk.position += size;
+        via_bulk.remaining -= size;
+        via_bulk.sequence++;
+
+        if (via_bulk.remaining == 0) {
+            via_bulk.state = VIA_BULK_IDLE;
+            via_bulk_send_end(id_bulk_status_ok);
+        }
+    }
+}
+#endif // VIA_BULK_TRANSFER_ENABLE
+
 // Keyboard level code can override this, but shouldn't need to.
 // Controlling custom features should be done by overriding
 // via_custom_value_command_kb() instead.
@@ -447,6 +653,21 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             dynamic_keymap_set_encoder(command_data[0], command_data[1], command_data[2] != 0, (command_data[3] << 8) | command_data[4]);
             break;
         }
+#endif
+#if defined(VIA_BULK_TRANSFER_ENABLE)
+        case VIA_BULK_TRANSFER_COMMAND_ID: {
+            if (!via_bulk_transfer_command(data, length)) {
+                return;
+            }
+            break;
+        }
+#endif
+#if defined(ADAPTIVE_TAPPING_TERM_ENABLE)
+        // Not a VIA command, Adaptive Tapping Term takes an id VIA leaves unassigned
+        case ADAPTIVE_TAPPING_TERM_RAW_HID_ID: {
+            adaptive_tapping_term_raw_hid_receive(data, length);
+            break;
+        }
 #endif
         default: {
             // The command ID is not known
@@ -96,6 +96,60 @@ enum via_command_id {
     id_unhandled                            = 0xFF,
 };
 
+// Bulk transfer extension, enabled with VIA_BULK_TRANSFER_ENABLE.
+//
+// A transfer is started with a single request, after which data reports
+// flow without a response for each one, each carrying a sequence number
+// so dropped or reordered reports are detected. The end report carries a
+// CRC-16/CCITT of everything transferred.
+//
+// Read:  host -> [ VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_read_start, region, offset (BE16), length (BE16) ]
+//        kb   -> same, with status at [7]
+//        kb   -> [ VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_data, seq, up to 29 bytes ]  (repeated)
+//        kb   -> [ VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_end, seq, crc (BE16), status ]
+// Write: host -> [ VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_write_start, region, offset (BE16), length (BE16) ]
+//        kb   -> same, with status at [7]
+//        host -> [ VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_data, seq, up to 29 bytes ]  (repeated, no response)
+//        host -> [ VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_end, seq, crc (BE16) ]
+//        kb   -> same, with status at [5]
+// A data report out of sequence aborts the transfer, and is answered with an
+// end report carrying the expected sequence number and an error status.
+//
+// Writes go through to EEPROM as the data arrives, a staging buffer at a
+// time, so they are not verified before being committed. When a write
+// fails after some of it was already written, id_bulk_status_resend_range
+// is set in the error status, and the host has to write the whole range
+// again to get back to a known state.
+//
+// The bulk transfer command id is not assigned by VIA, so it can be moved
+// with VIA_BULK_TRANSFER_COMMAND_ID should it clash with a host tool.
+#ifndef VIA_BULK_TRANSFER_COMMAND_ID
+#    define VIA_BULK_TRANSFER_COMMAND_ID 0x16
+#endif
+
+enum via_bulk_transfer_op {
+    id_bulk_read_start  = 0x01,
+    id_bulk_write_start = 0x02,
+    id_bulk_data        = 0x03,
+    id_bulk_end         = 0x04,
+};
+
+enum via_bulk_transfer_region {
+    id_bulk_region_keymap = 0x01,
+    id_bulk_region_macro  = 0x02,
+};
+
+enum via_bulk_transfer_status {
+    id_bulk_status_ok             = 0x00,
+    id_bulk_status_invalid        = 0x01,
+    id_bulk_status_sequence_error = 0x02,
+    id_bulk_status_checksum_error = 0x03,
+    // Flag set in an error status once part of the range has been written
+    id_bulk_status_resend_range = 0x80,
+};
+
+#define VIA_BULK_PAYLOAD_SIZE 29
+
 enum via_keyboard_value_id {
     id_uptime              = 0x01,
     id_layout_options      = 0x02,
@@ -168,6 +222,11 @@ void via_set_device_indication(uint8_t value);
 // Called by QMK core to process VIA-specific keycodes.
 bool process_record_via(uint16_t keycode, keyrecord_t *record);
 
+#if defined(VIA_BULK_TRANSFER_ENABLE)
+// Called by QMK core to stream bulk transfer reports.
+void via_task(void);
+#endif
+
 // These are made external so that keyboard level custom value handlers can use them.
 #if defined(BACKLIGHT_ENABLE)
 void via_qmk_backlight_command(uint8_t *data, uint8_t length);
@@ -18,17 +18,21 @@ void MockBackingStore::reset_instance() {
     backing_max_write_count   = 0;
     backing_total_write_count = 0;
 
-    backing_init_invoke_count   = 0;
-    backing_unlock_invoke_count = 0;
-    backing_erase_invoke_count  = 0;
-    backing_write_invoke_count  = 0;
-    backing_lock_invoke_count   = 0;
+    backing_init_invoke_count       = 0;
+    backing_unlock_invoke_count     = 0;
+    backing_erase_invoke_count      = 0;
+    backing_write_invoke_count      = 0;
+    backing_write_bulk_invoke_count = 0;
+    backing_lock_invoke_count       = 0;
+    backing_read_invoke_count       = 0;
+    backing_read_bulk_invoke_count  = 0;
 
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
     unlock_success_callback = [](std::uint64_t) { return true; };
     write_success_callback  = [](std::uint64_t, std::uint32_t) { return true; };
     lock_success_callback   = [](std::uint64_t) { return true; };
+    read_success_callback   = [](std::uint64_t, std::uint32_t) { return true; };
 
     write_log.clear();
 }
@@ -101,6 +105,18 @@ bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     return true;
 }
 
+bool MockBackingStore::write_bulk(uint32_t address, const backing_store_int_t* values, std::size_t item_count) {
+    ++backing_write_bulk_invoke_count;
+
+    // Each value goes through the same checks and failure injection as a single write
+    for (std::size_t i = 0; i < item_count; ++i) {
+        if (!write(address + (i * BACKING_STORE_WRITE_SIZE), values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool MockBackingStore::lock(void) {
     ++backing_lock_invoke_count;
 
@@ -114,10 +130,17 @@ bool MockBackingStore::lock(void) {
 }
 
 bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const {
+    ++backing_read_invoke_count;
+
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
     EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
 
+    // Drop out of read early with failure if we need to
+    if (read_success_callback && !read_success_callback(backing_read_invoke_count, address)) {
+        return false;
+    }
+
     // Read and take the complement as we're simulating flash memory -- 0xFF means 0x00
     std::size_t index = address / BACKING_STORE_WRITE_SIZE;
     value             = ~backing_storage[index].get();
@@ -125,6 +148,17 @@ bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const
     return true;
 }
 
+bool MockBackingStore::read_bulk(uint32_t address, backing_store_int_t* values, std::size_t item_count) const {
+    ++backing_read_bulk_invoke_count;
+
+    for (std::size_t i = 0; i < item_count; ++i) {
+        if (!read(address + (i * BACKING_STORE_WRITE_SIZE), values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Backing Implementation
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,6 +179,10 @@ extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value)
     return MockBackingStore::Instance().write(address, value);
 }
 
+extern "C" bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, size_t item_count) {
+    return MockBackingStore::Instance().write_bulk(address, values, item_count);
+}
+
 extern "C" bool backing_store_lock(void) {
     return MockBackingStore::Instance().lock();
 }
@@ -152,3 +190,7 @@ extern "C" bool backing_store_lock(void) {
 extern "C" bool backing_store_read(uint32_t address, backing_store_int_t* value) {
     return MockBackingStore::Instance().read(address, *value);
 }
+
+extern "C" bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count) {
+    return MockBackingStore::Instance().read_bulk(address, values, item_count);
+}
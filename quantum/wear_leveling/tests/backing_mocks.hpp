@@ -95,7 +95,10 @@ class MockBackingStore {
     std::uint64_t backing_unlock_invoke_count;
     std::uint64_t backing_erase_invoke_count;
     std::uint64_t backing_write_invoke_count;
+    std::uint64_t backing_write_bulk_invoke_count;
     std::uint64_t backing_lock_invoke_count;
+    mutable std::uint64_t backing_read_invoke_count;
+    mutable std::uint64_t backing_read_bulk_invoke_count;
 
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
@@ -107,6 +110,8 @@ class MockBackingStore {
     std::function<bool(std::uint64_t, std::uint32_t)> write_success_callback;
     // Whether locks should succeed
     std::function<bool(std::uint64_t)> lock_success_callback;
+    // Whether reads should succeed
+    std::function<bool(std::uint64_t, std::uint32_t)> read_success_callback;
 
     template <typename... Args>
     void append_log(Args&&... args) {
@@ -147,6 +152,15 @@ class MockBackingStore {
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t write_bulk_invoke_count() const {
+        return backing_write_bulk_invoke_count;
+    }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
+    std::uint64_t read_bulk_invoke_count() const {
+        return backing_read_bulk_invoke_count;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -160,8 +174,10 @@ class MockBackingStore {
     bool unlock();
     bool erase();
     bool write(std::uint32_t address, backing_store_int_t value);
+    bool write_bulk(std::uint32_t address, const backing_store_int_t* values, std::size_t item_count);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
+    bool read_bulk(std::uint32_t address, backing_store_int_t* values, std::size_t item_count) const;
 
     // Control over when init/writes/erases should succeed
     void set_init_callback(std::function<bool(std::uint64_t)> callback) {
@@ -179,6 +195,9 @@ class MockBackingStore {
     void set_lock_callback(std::function<bool(std::uint64_t)> callback) {
         lock_success_callback = callback;
     }
+    void set_read_callback(std::function<bool(std::uint64_t, std::uint32_t)> callback) {
+        read_success_callback = callback;
+    }
 
     auto storage_begin() const -> decltype(backing_storage.begin()) {
         return backing_storage.begin();
@@ -63,4 +63,40 @@ wear_leveling_8byte_SRC := \
 	$(wear_leveling_common_SRC) \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
-	$(wear_leveling_common_INC)
\ No newline at end of file
+	$(wear_leveling_common_INC)
+wear_leveling_bulk_writes_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=4096 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024
+wear_leveling_bulk_writes_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_bulk_writes.cpp
+wear_leveling_bulk_writes_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_deferred_consolidation_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=1024 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=256 \
+	-DWEAR_LEVELING_DEFERRED_CONSOLIDATION \
+	-DEEPROM_WEAR_LEVELING
+wear_leveling_deferred_consolidation_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(TOP_DIR)/drivers/eeprom/eeprom_wear_leveling.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_deferred_consolidation.cpp
+wear_leveling_deferred_consolidation_INC := \
+	$(wear_leveling_common_INC) \
+	$(TOP_DIR)/drivers/eeprom
+
+wear_leveling_fast_init_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=65536 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16384
+wear_leveling_fast_init_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_fast_init.cpp
+wear_leveling_fast_init_INC := \
+	$(wear_leveling_common_INC)
@@ -3,4 +3,7 @@ TEST_LIST += \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_bulk_writes \
+	wear_leveling_deferred_consolidation \
+	wear_leveling_fast_init
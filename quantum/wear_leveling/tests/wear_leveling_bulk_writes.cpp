@@ -0,0 +1,94 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <iostream>
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingBulkWrites : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+
+    static std::uint64_t expected_bulk_writes(std::uint64_t word_writes) {
+        return (word_writes + (WEAR_LEVELING_APPEND_BATCH_COUNT)-1) / (WEAR_LEVELING_APPEND_BATCH_COUNT);
+    }
+};
+
+/**
+ * This test verifies that a logical write fitting in a single log entry is programmed with a single bulk write.
+ */
+TEST_F(WearLevelingBulkWrites, SingleEntry_SingleBulkWrite) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, 5> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+    EXPECT_EQ(wear_leveling_write(200, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    EXPECT_EQ(inst.write_invoke_count(), 4) << "Multibyte entry should have been four backing writes";
+    EXPECT_EQ(inst.write_bulk_invoke_count(), 1) << "Entry should have been programmed with one bulk write";
+}
+
+/**
+ * This test verifies that the log entries of a longer logical write are programmed a batch at a time.
+ */
+TEST_F(WearLevelingBulkWrites, MultipleEntries_Batched) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, 28> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+    EXPECT_EQ(wear_leveling_write(200, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    EXPECT_GT(inst.write_invoke_count(), WEAR_LEVELING_APPEND_BATCH_COUNT) << "Write should have needed more than one batch";
+    EXPECT_EQ(inst.write_bulk_invoke_count(), expected_bulk_writes(inst.write_invoke_count())) << "Entries should have been programmed a batch at a time";
+
+    std::array<std::uint8_t, 28> readback;
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(wear_leveling_read(200, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_THAT(readback, ::testing::ElementsAreArray(testvalue)) << "Playback should have recovered the written data";
+}
+
+/**
+ * This test verifies that writes filling the log part way through a batch still consolidate, and that everything can be played back afterwards.
+ */
+TEST_F(WearLevelingBulkWrites, LogFullMidBatch_ConsolidatesAndPlaysBack) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected{};
+    std::uint8_t                                         seed = 0x31;
+    for (std::uint32_t address = 64; inst.erasure_count() < 3; address = (address + 37) % (WEAR_LEVELING_LOGICAL_SIZE - 16)) {
+        std::array<std::uint8_t, 13> testvalue;
+        for (auto& v : testvalue) {
+            v = seed;
+            seed += 0x4B;
+        }
+        std::copy(testvalue.begin(), testvalue.end(), expected.begin() + address);
+        EXPECT_NE(wear_leveling_write(address, testvalue.data(), testvalue.size()), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_THAT(readback, ::testing::ElementsAreArray(expected)) << "Playback should have recovered the written data";
+}
+
+/**
+ * Not a pass/fail benchmark, prints the backing store calls made syncing a keymap in VIA sized chunks.
+ */
+TEST_F(WearLevelingBulkWrites, KeymapSync_BackingStoreCalls) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, 720> keymap;
+    for (std::size_t i = 0; i < keymap.size(); ++i) {
+        keymap[i] = (std::uint8_t)(i * 7 + 11);
+    }
+    for (std::uint32_t offset = 0; offset < keymap.size(); offset += 28) {
+        std::size_t length = std::min<std::size_t>(28, keymap.size() - offset);
+        EXPECT_NE(wear_leveling_write(64 + offset, &keymap[offset], length), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    }
+
+    std::cout << "Keymap sync of " << keymap.size() << " bytes: " << inst.write_invoke_count() << " backing store writes in " << inst.write_bulk_invoke_count() << " bulk writes, " << inst.erase_invoke_count() << " erases" << std::endl;
+}
@@ -0,0 +1,201 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+extern "C" {
+#include "eeprom_driver.h"
+}
+
+using Snapshot = std::vector<MockBackingStoreElement>;
+
+// Time since the last input, as seen by eeprom_driver_task()
+static std::uint32_t input_idle_ms = UINT32_MAX;
+
+extern "C" uint32_t last_input_activity_elapsed(void) {
+    return input_idle_ms;
+}
+
+class WearLevelingDeferredConsolidation : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        expected.fill(0);
+        seed = 0x17;
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected;
+    std::uint8_t                                         seed;
+
+    // Writes a 4-byte value, keeping track of what the logical data should be
+    wear_leveling_status_t write_next(std::uint32_t address) {
+        std::array<std::uint8_t, 4> value;
+        for (auto& v : value) {
+            v = seed;
+            seed += 0x3D;
+        }
+        std::copy(value.begin(), value.end(), expected.begin() + address);
+        return wear_leveling_write(address, value.data(), value.size());
+    }
+
+    // Fills the write log up to the high-water mark, checking nothing was consolidated inline
+    void write_past_high_water() {
+        auto&         inst    = MockBackingStore::Instance();
+        std::uint32_t address = 0;
+        while ((WEAR_LEVELING_LOGICAL_SIZE) + 8 + inst.total_write_count() * (BACKING_STORE_WRITE_SIZE) < (WEAR_LEVELING_CONSOLIDATE_HIGH_WATER)) {
+            EXPECT_EQ(write_next(address), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+            address = (address + 12) % (WEAR_LEVELING_LOGICAL_SIZE - 4);
+        }
+        EXPECT_EQ(inst.erase_invoke_count(), 0) << "Nothing should have been consolidated inline";
+    }
+
+    static Snapshot snapshot() {
+        auto& inst = MockBackingStore::Instance();
+        return Snapshot(inst.storage_begin(), inst.storage_end());
+    }
+
+    // Simulates a power loss with the backing store as it was at the time of the snapshot, returning what a reboot reads back
+    static std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> reboot_from(const Snapshot& snap) {
+        std::copy(snap.begin(), snap.end(), MockBackingStore::Instance().storage_begin());
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Init returned incorrect status";
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        return readback;
+    }
+};
+
+/**
+ * This test verifies that nothing happens in the background while the log is below its high-water mark.
+ */
+TEST_F(WearLevelingDeferredConsolidation, BelowHighWater_TaskIdle) {
+    auto& inst = MockBackingStore::Instance();
+
+    EXPECT_EQ(write_next(0x10), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    uint64_t unlock_count = inst.unlock_invoke_count();
+    uint64_t write_count  = inst.write_invoke_count();
+
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.unlock_invoke_count(), unlock_count) << "Task should not have touched the backing store";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Task should not have touched the backing store";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Task should not have erased";
+}
+
+/**
+ * This test verifies that past the high-water mark, consolidation is done by the task in small steps.
+ */
+TEST_F(WearLevelingDeferredConsolidation, HighWater_ConsolidatesInSteps) {
+    auto& inst = MockBackingStore::Instance();
+    write_past_high_water();
+
+    // First step erases
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "First step should have erased";
+
+    // Following steps program a chunk at a time, until the checksum is written
+    const std::size_t chunk_writes = (WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE) / (BACKING_STORE_WRITE_SIZE);
+    std::size_t       steps        = 0;
+    wear_leveling_status_t status;
+    do {
+        uint64_t write_count = inst.write_invoke_count();
+        status               = wear_leveling_task();
+        EXPECT_NE(status, WEAR_LEVELING_FAILED) << "Task returned incorrect status";
+        EXPECT_LE(inst.write_invoke_count() - write_count, chunk_writes + 8 / (BACKING_STORE_WRITE_SIZE)) << "Step programmed more than a chunk";
+        ++steps;
+    } while (status != WEAR_LEVELING_CONSOLIDATED && steps < 1000);
+    EXPECT_EQ(steps, (WEAR_LEVELING_LOGICAL_SIZE) / (WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE)) << "Unexpected number of programming steps";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Only one erase should have occurred";
+
+    // Nothing more to do, and the data survives a reboot
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_THAT(reboot_from(snapshot()), ::testing::ElementsAreArray(expected)) << "Consolidated data should have been recovered";
+}
+
+/**
+ * This test verifies that a write arriving part way through programming completes the consolidation before it is logged.
+ */
+TEST_F(WearLevelingDeferredConsolidation, WriteDuringProgramming_FinishesFirst) {
+    auto& inst = MockBackingStore::Instance();
+    write_past_high_water();
+
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Erase step returned incorrect status";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Programming step returned incorrect status";
+
+    EXPECT_EQ(write_next(0x40), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task should have nothing left to do";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Only one erase should have occurred";
+    EXPECT_THAT(reboot_from(snapshot()), ::testing::ElementsAreArray(expected)) << "Consolidated data and the new write should have been recovered";
+}
+
+/**
+ * This test verifies that if the task never gets to run, a full log still consolidates inline.
+ */
+TEST_F(WearLevelingDeferredConsolidation, TaskNeverRuns_LogFullConsolidatesInline) {
+    auto&         inst    = MockBackingStore::Instance();
+    std::uint32_t address = 0;
+    while (inst.erase_invoke_count() == 0) {
+        EXPECT_NE(write_next(address), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+        address = (address + 12) % (WEAR_LEVELING_LOGICAL_SIZE - 4);
+    }
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task should have nothing left to do";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Only one erase should have occurred";
+    EXPECT_THAT(reboot_from(snapshot()), ::testing::ElementsAreArray(expected)) << "Consolidated data should have been recovered";
+}
+
+/**
+ * This test simulates a power loss after every step of a deferred consolidation. Up to the erase the write log is intact
+ * and everything is recovered. Between the erase and the checksum being written the consolidated area is rejected as a
+ * whole -- a reboot must never see a mix of programmed and unprogrammed data.
+ */
+TEST_F(WearLevelingDeferredConsolidation, PowerLossAtEveryStep_Consistent) {
+    write_past_high_water();
+    auto logical = expected;
+
+    std::vector<Snapshot> snapshots;
+    snapshots.push_back(snapshot());
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_task();
+        EXPECT_NE(status, WEAR_LEVELING_FAILED) << "Task returned incorrect status";
+        snapshots.push_back(snapshot());
+    } while (status != WEAR_LEVELING_CONSOLIDATED && snapshots.size() < 1000);
+
+    const std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> blank{};
+    for (std::size_t i = 0; i < snapshots.size(); ++i) {
+        auto readback = reboot_from(snapshots[i]);
+        if (i == 0 || i == snapshots.size() - 1) {
+            EXPECT_THAT(readback, ::testing::ElementsAreArray(logical)) << "Power loss at step " << i << " should have recovered everything";
+        } else {
+            EXPECT_THAT(readback, ::testing::ElementsAreArray(blank)) << "Power loss at step " << i << " should have rejected the partial consolidation";
+        }
+    }
+}
+
+/**
+ * This test verifies that the EEPROM driver waits for input to go idle before erasing, but once the backing store has
+ * been erased it programs the rest of the consolidation on every task call, even while typing carries on.
+ */
+TEST_F(WearLevelingDeferredConsolidation, EepromDriverTask_TypingAfterErase_StillCompletes) {
+    auto& inst = MockBackingStore::Instance();
+    write_past_high_water();
+
+    input_idle_ms = 0;
+    eeprom_driver_task();
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Erase should have waited for input to go idle";
+
+    input_idle_ms = UINT32_MAX;
+    eeprom_driver_task();
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Erase should have happened once input was idle";
+    EXPECT_TRUE(wear_leveling_consolidation_in_progress()) << "Programming should be left to do";
+
+    input_idle_ms = 0;
+    for (std::size_t steps = 0; steps < (WEAR_LEVELING_LOGICAL_SIZE) / (WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE); ++steps) {
+        eeprom_driver_task();
+    }
+    EXPECT_FALSE(wear_leveling_consolidation_in_progress()) << "Programming should have finished while typing";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Only one erase should have occurred";
+    EXPECT_THAT(reboot_from(snapshot()), ::testing::ElementsAreArray(expected)) << "Consolidated data should have been recovered";
+    input_idle_ms = UINT32_MAX;
+}
@@ -0,0 +1,132 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <chrono>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingFastInit : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        expected.fill(0);
+        seed = 0x12345678;
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected;
+    std::uint32_t                                        seed;
+
+    std::uint32_t next_random() {
+        seed = seed * 1664525 + 1013904223;
+        return seed >> 8;
+    }
+
+    // Writes a random 5-byte value at a random address
+    void write_random() {
+        std::array<std::uint8_t, LOG_ENTRY_MULTIBYTE_MAX_BYTES> value;
+        for (auto& v : value) {
+            v = next_random() | 0x80; // avoid the 2-byte 0/1 word optimisation
+        }
+        std::uint32_t address = 64 + next_random() % (WEAR_LEVELING_LOGICAL_SIZE - 64 - value.size());
+        std::copy(value.begin(), value.end(), expected.begin() + address);
+        EXPECT_NE(wear_leveling_write(address, value.data(), value.size()), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    }
+
+    // Fills the write log to within one entry of triggering consolidation
+    std::uint64_t fill_log() {
+        auto& inst = MockBackingStore::Instance();
+        while ((WEAR_LEVELING_LOGICAL_SIZE) + 8 + (inst.total_write_count() + 4) * (BACKING_STORE_WRITE_SIZE) < (WEAR_LEVELING_BACKING_SIZE)) {
+            write_random();
+        }
+        EXPECT_EQ(inst.erase_invoke_count(), 0) << "Log should not have been consolidated";
+        return inst.total_write_count();
+    }
+};
+
+/**
+ * This test verifies the checksum written on consolidation is the FNV1a_64 of the consolidated data.
+ */
+TEST_F(WearLevelingFastInit, ConsolidatedChecksum_MatchesFnv64a) {
+    auto& inst = MockBackingStore::Instance();
+    while (inst.erase_invoke_count() == 0) {
+        write_random();
+    }
+
+    write_log_entry_t e;
+    EXPECT_TRUE(backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), e.raw16, 4)) << "Failed to read checksum";
+    EXPECT_EQ(e.raw64, fnv_64a_buf(expected.data(), expected.size(), FNV1A_64_INIT)) << "Invalid checksum";
+}
+
+/**
+ * This test verifies that playback reads the write log a buffer at a time, and recovers everything that was written.
+ */
+TEST_F(WearLevelingFastInit, Playback_ReadsLogInBulk) {
+    auto&         inst      = MockBackingStore::Instance();
+    std::uint64_t log_words = fill_log();
+
+    std::uint64_t reads      = inst.read_invoke_count();
+    std::uint64_t bulk_reads = inst.read_bulk_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+
+    // Consolidated area, checksum, then the log plus the empty slot following it
+    std::uint64_t log_bulk_reads = (log_words + 1 + (WEAR_LEVELING_PLAYBACK_BUFFER_COUNT)-1) / (WEAR_LEVELING_PLAYBACK_BUFFER_COUNT);
+    EXPECT_LE(inst.read_bulk_invoke_count() - bulk_reads, 2 + log_bulk_reads) << "Log should have been read a buffer at a time";
+    EXPECT_LE(inst.read_invoke_count() - reads, (WEAR_LEVELING_BACKING_SIZE) / (BACKING_STORE_WRITE_SIZE)) << "Backing store should have been read no more than once";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_THAT(readback, ::testing::ElementsAreArray(expected)) << "Playback should have recovered the written data";
+}
+
+/**
+ * This test verifies that an unreadable word part-way through a bulk read window, such as a torn last entry after a
+ * power loss, only loses that entry -- everything logged before it in the same window is still played back.
+ */
+TEST_F(WearLevelingFastInit, Playback_BulkReadFailure_KeepsEarlierEntries) {
+    auto& inst = MockBackingStore::Instance();
+    for (int i = 0; i < 4; ++i) {
+        write_random();
+    }
+    auto survivors = expected;
+    write_random();
+
+    // The torn entry's last word sits within the first window of the log
+    std::uint32_t torn_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8 + (inst.total_write_count() - 1) * (BACKING_STORE_WRITE_SIZE);
+    EXPECT_LT(torn_address, (WEAR_LEVELING_LOGICAL_SIZE) + 8 + (WEAR_LEVELING_PLAYBACK_BUFFER_COUNT) * (BACKING_STORE_WRITE_SIZE)) << "Torn entry should be inside the first window";
+    inst.set_read_callback([torn_address](std::uint64_t, std::uint32_t address) { return address != torn_address; });
+
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Init returned incorrect status";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Unreadable log should have been consolidated";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_THAT(readback, ::testing::ElementsAreArray(survivors)) << "Entries before the torn one should have been played back";
+}
+
+/**
+ * Not a pass/fail benchmark, prints how long startup takes with a nearly full write log, along with the backing store
+ * calls made, and the time a byte at a time fnv_64a_buf() takes over the same logical size for comparison.
+ */
+TEST_F(WearLevelingFastInit, InitTimeReport) {
+    auto&            inst      = MockBackingStore::Instance();
+    std::uint64_t    log_words = fill_log();
+    const unsigned   rounds    = 20;
+    volatile uint8_t sink      = 0;
+
+    std::uint64_t bulk_reads = inst.read_bulk_invoke_count();
+    auto          start      = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < rounds; ++i) {
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    }
+    double init_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+    start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < rounds; ++i) {
+        sink = sink + (uint8_t)fnv_64a_buf(expected.data(), expected.size(), FNV1A_64_INIT);
+    }
+    double fnv_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+    std::cout << "Init of " << (WEAR_LEVELING_LOGICAL_SIZE) << " bytes with " << log_words << " log words: " << init_us << "us, " << (inst.read_bulk_invoke_count() - bulk_reads) / rounds << " bulk reads (fnv_64a_buf alone " << fnv_us << "us)" << std::endl;
+}
@@ -66,14 +66,17 @@
         During initialization:
             * The contents of the consolidated data section are read into cache.
             * The contents of the write log are "played back" and update the
-                cache accordingly.
+                cache accordingly. The log is read in bulk, a buffer's worth of
+                entries at a time.
 
         During reads:
             * Logical data is served from the cache.
 
         During writes:
             * The cache is updated with the new data.
-            * A new write log entry is appended to the log.
+            * New write log entries are appended to the log, batched up so
+                each logical write is programmed with as few bulk writes as
+                possible.
             * If the log's full, data is consolidated and the write log cleared.
 
     Write log structure:
@@ -162,8 +165,25 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+    backing_store_int_t                                            pending[(WEAR_LEVELING_APPEND_BATCH_COUNT)];
+    size_t                                                         pending_count;
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+    uint8_t  consolidation;
+    uint32_t consolidation_address;
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
 } wear_leveling;
 
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+/**
+ * Deferred consolidation progress.
+ */
+enum {
+    CONSOLIDATION_IDLE,        //< Nothing to do
+    CONSOLIDATION_PENDING,     //< Log is past the high-water mark, the backing store is to be erased
+    CONSOLIDATION_PROGRAMMING, //< Backing store erased, cache being programmed from consolidation_address onwards
+};
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
+
 /**
  * Locking helper: status
  */
@@ -203,6 +223,30 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.pending_count = 0;
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+    wear_leveling.consolidation = CONSOLIDATION_IDLE;
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
+}
+
+/**
+ * FNV1a_64 of the cache, giving the same result as fnv_64a_buf(). The multiplication by the FNV prime is split into
+ * 32-bit halves, so MCUs without a 64-bit multiply don't need a library call for every byte hashed.
+ */
+static uint64_t wear_leveling_cache_hash(void) {
+    uint32_t hi = (uint32_t)(FNV1A_64_INIT >> 32);
+    uint32_t lo = (uint32_t)FNV1A_64_INIT;
+    for (size_t i = 0; i < (WEAR_LEVELING_LOGICAL_SIZE); ++i) {
+        lo ^= wear_leveling.cache[i];
+
+        // hash *= 0x100000001b3, which is hash * 0x1b3 + (hash << 40)
+        uint32_t lo_lo = (lo & 0xFFFF) * 0x1b3;
+        uint32_t lo_hi = (lo >> 16) * 0x1b3;
+        uint32_t low   = lo_lo + (lo_hi << 16);
+        hi             = hi * 0x1b3 + (lo_hi >> 16) + (low < lo_lo ? 1 : 0) + (lo << 8);
+        lo             = low;
+    }
+    return ((uint64_t)hi << 32) | lo;
 }
 
 /**
@@ -220,7 +264,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
 
     // Verify the FNV1a_64 result
     if (status != WEAR_LEVELING_FAILED) {
-        uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+        uint64_t          expected = wear_leveling_cache_hash();
         write_log_entry_t entry;
         wl_dprintf("Reading checksum\n");
 #if BACKING_STORE_WRITE_SIZE == 2
@@ -249,16 +293,16 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
 }
 
 /**
- * Writes the current cache to consolidated data at the beginning of the backing store.
+ * Writes the current cache to consolidated data at the beginning of the backing store, from the supplied offset onwards.
  * Does not clear the write log.
  * Pre-condition: this is just after an erase, so we can write directly without reading.
  */
-static wear_leveling_status_t wear_leveling_write_consolidated(void) {
+static wear_leveling_status_t wear_leveling_write_consolidated(uint32_t start) {
     wl_dprintf("Writing consolidated data\n");
 
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     wear_leveling_status_t      status      = WEAR_LEVELING_CONSOLIDATED;
-    if (!backing_store_write_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_write_bulk(start, (backing_store_int_t *)&wear_leveling.cache[start], ((WEAR_LEVELING_LOGICAL_SIZE) - start) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to write to backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -266,7 +310,7 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
     if (status != WEAR_LEVELING_FAILED) {
         // Write out the FNV1a_64 result of the consolidated data
         write_log_entry_t entry;
-        entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+        entry.raw64 = wear_leveling_cache_hash();
         wl_dprintf("Writing checksum\n");
         do {
 #if BACKING_STORE_WRITE_SIZE == 2
@@ -310,17 +354,39 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Write the cache to the first section of the backing store.
-    wear_leveling_status_t status = wear_leveling_write_consolidated();
+    wear_leveling_status_t status = wear_leveling_write_consolidated(0);
     if (status == WEAR_LEVELING_FAILED) {
         wl_dprintf("Failed to write consolidated data\n");
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+    wear_leveling.consolidation = CONSOLIDATION_IDLE;
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
 
     return status;
 }
 
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+/**
+ * Completes an in-progress deferred consolidation in one go, programming whatever of the cache is still outstanding.
+ * Needs to happen before the cache is modified, as the consolidated area programmed so far came from the cache as-is.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_finish(void) {
+    wl_dprintf("Finishing deferred consolidation\n");
+
+    wear_leveling_status_t status = wear_leveling_write_consolidated(wear_leveling.consolidation_address);
+    if (status == WEAR_LEVELING_FAILED) {
+        wl_dprintf("Failed to write consolidated data\n");
+    }
+
+    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.consolidation = CONSOLIDATION_IDLE;
+    return status;
+}
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
+
 /**
  * Potential write of the current cache to the backing store.
  * Skipped if the current write log position is not at the end of the backing store.
@@ -333,24 +399,52 @@ static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
         return wear_leveling_consolidate_force();
     }
 
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+    // Past the high-water mark, leave it to wear_leveling_task() to consolidate before the log fills up
+    if (wear_leveling.write_address >= (WEAR_LEVELING_CONSOLIDATE_HIGH_WATER) && wear_leveling.consolidation == CONSOLIDATION_IDLE) {
+        wl_dprintf("Write log past high-water mark, deferring consolidation\n");
+        wear_leveling.consolidation = CONSOLIDATION_PENDING;
+    }
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
+
     return WEAR_LEVELING_SUCCESS;
 }
 
 /**
- * Appends the supplied fixed-width entry to the write log, optionally consolidating if the log is full.
+ * Programs the pending write log entries in a single bulk write, optionally consolidating if the log is full.
  *
  * @return true if consolidation occurred
  */
-static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value) {
-    bool ok = backing_store_write(wear_leveling.write_address, value);
+static wear_leveling_status_t wear_leveling_flush_pending(void) {
+    size_t count                = wear_leveling.pending_count;
+    wear_leveling.pending_count = 0;
+    if (count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    bool ok = backing_store_write_bulk(wear_leveling.write_address, wear_leveling.pending, count);
     if (!ok) {
         wl_dprintf("Failed to write to backing store\n");
         return WEAR_LEVELING_FAILED;
     }
-    wear_leveling.write_address += (BACKING_STORE_WRITE_SIZE);
+    wear_leveling.write_address += count * (BACKING_STORE_WRITE_SIZE);
     return wear_leveling_consolidate_if_needed();
 }
 
+/**
+ * Appends the supplied fixed-width entry to the write log. Entries are batched up and programmed together once the
+ * batch is full, the log is full, or the logical write producing them is complete.
+ *
+ * @return true if consolidation occurred
+ */
+static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value) {
+    wear_leveling.pending[wear_leveling.pending_count++] = value;
+    if (wear_leveling.pending_count == (WEAR_LEVELING_APPEND_BATCH_COUNT) || wear_leveling.write_address + wear_leveling.pending_count * (BACKING_STORE_WRITE_SIZE) >= (WEAR_LEVELING_BACKING_SIZE)) {
+        return wear_leveling_flush_pending();
+    }
+    return WEAR_LEVELING_SUCCESS;
+}
+
 /**
  * Handles writing multi_byte-encoded data to the backing store.
  *
@@ -466,7 +560,50 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
         p += this_length;
     }
 
-    return status;
+    // Program whatever is left of the batch
+    return wear_leveling_flush_pending();
+}
+
+/**
+ * Read-ahead buffer for write log playback.
+ */
+typedef struct wear_leveling_playback_buffer_t {
+    backing_store_int_t values[(WEAR_LEVELING_PLAYBACK_BUFFER_COUNT)];
+    uint32_t            address; //< Backing store address of values[0]
+    size_t              count;   //< Number of valid entries in values
+} wear_leveling_playback_buffer_t;
+
+/**
+ * Reads a write log word during playback, refilling the buffer with a bulk read whenever the address falls outside it.
+ *
+ * A failed bulk read (e.g. an ECC error on a torn entry) is retried a word at a time, so the buffer still holds every
+ * word leading up to the unreadable one and playback only stops once it reaches it.
+ */
+static bool wear_leveling_playback_read(wear_leveling_playback_buffer_t *buffer, uint32_t address, backing_store_int_t *value) {
+    if (address >= (WEAR_LEVELING_BACKING_SIZE)) {
+        return false;
+    }
+    if (address < buffer->address || address >= buffer->address + buffer->count * (BACKING_STORE_WRITE_SIZE)) {
+        size_t count = ((WEAR_LEVELING_BACKING_SIZE) - address) / (BACKING_STORE_WRITE_SIZE);
+        if (count > (WEAR_LEVELING_PLAYBACK_BUFFER_COUNT)) {
+            count = (WEAR_LEVELING_PLAYBACK_BUFFER_COUNT);
+        }
+        buffer->count = 0;
+        if (!backing_store_read_bulk(address, buffer->values, count)) {
+            size_t readable = 0;
+            while (readable < count && backing_store_read(address + readable * (BACKING_STORE_WRITE_SIZE), &buffer->values[readable])) {
+                readable++;
+            }
+            if (readable == 0) {
+                return false;
+            }
+            count = readable;
+        }
+        buffer->address = address;
+        buffer->count   = count;
+    }
+    *value = buffer->values[(address - buffer->address) / (BACKING_STORE_WRITE_SIZE)];
+    return true;
 }
 
 /**
@@ -475,12 +612,14 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
 static wear_leveling_status_t wear_leveling_playback_log(void) {
     wl_dprintf("Playback write log\n");
 
+    wear_leveling_playback_buffer_t buffer = {.address = 0, .count = 0};
+
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
     uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
     while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = wear_leveling_playback_read(&buffer, address, &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -509,7 +648,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = wear_leveling_playback_read(&buffer, address, &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -529,7 +668,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = wear_leveling_playback_read(&buffer, address, &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -539,7 +678,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = wear_leveling_playback_read(&buffer, address, &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -550,7 +689,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = wear_leveling_playback_read(&buffer, address, &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -688,6 +827,15 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return true;
     }
 
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+    // The log was erased by an in-progress consolidation, so it needs completing before the log can be used again
+    if (wear_leveling.consolidation == CONSOLIDATION_PROGRAMMING) {
+        if (wear_leveling_consolidate_finish() == WEAR_LEVELING_FAILED) {
+            return WEAR_LEVELING_FAILED;
+        }
+    }
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
+
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
@@ -726,6 +874,62 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+/**
+ * Performs one step of a deferred consolidation, if one is due: either the erase of the backing store, or programming
+ * the next chunk of the cache into the consolidated area.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+    if (wear_leveling.consolidation == CONSOLIDATION_IDLE) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    if (wear_leveling.consolidation == CONSOLIDATION_PENDING) {
+        wl_dprintf("Erasing backing store\n");
+        if (backing_store_erase()) {
+            wear_leveling.consolidation         = CONSOLIDATION_PROGRAMMING;
+            wear_leveling.consolidation_address = 0;
+        } else {
+            wl_dprintf("Failed to erase backing store\n");
+            status = WEAR_LEVELING_FAILED;
+        }
+    } else if (wear_leveling.consolidation_address + (WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE) < (WEAR_LEVELING_LOGICAL_SIZE)) {
+        wl_dprintf("Writing consolidated data chunk\n");
+        if (backing_store_write_bulk(wear_leveling.consolidation_address, (backing_store_int_t *)&wear_leveling.cache[wear_leveling.consolidation_address], (WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE) / sizeof(backing_store_int_t))) {
+            wear_leveling.consolidation_address += (WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE);
+        } else {
+            wl_dprintf("Failed to write to backing store\n");
+            status = WEAR_LEVELING_FAILED;
+        }
+    } else {
+        // Last chunk, along with the checksum
+        status = wear_leveling_consolidate_finish();
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Whether the backing store has been erased for a deferred consolidation that is still programming.
+ */
+bool wear_leveling_consolidation_in_progress(void) {
+    return wear_leveling.consolidation == CONSOLIDATION_PROGRAMMING;
+}
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
+
 /**
  * Reads logical data from the cache.
  */
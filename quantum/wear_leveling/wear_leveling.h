@@ -1,6 +1,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -52,3 +53,25 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+/**
+ * Performs one step of a deferred consolidation.
+ *
+ * Once the write log passes its high-water mark, consolidation is left to this function instead of happening inline
+ * when the log fills. Each invocation either erases the backing store or programs the next chunk of the consolidated
+ * area. Writes made while programming is in progress complete the consolidation first.
+ *
+ * @return Status of the request, WEAR_LEVELING_CONSOLIDATED once the final step has been performed
+ */
+wear_leveling_status_t wear_leveling_task(void);
+
+/**
+ * Whether a deferred consolidation has erased the backing store and not yet finished programming it.
+ *
+ * A power loss in the meantime reads back blank data, so the remaining steps should not be held back.
+ *
+ * @return true while the consolidated area is being programmed
+ */
+bool wear_leveling_consolidation_in_progress(void);
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
@@ -61,10 +61,35 @@ typedef uint64_t backing_store_int_t;
         } while (0)
 #endif // WEAR_LEVELING_ASSERTS
 
+// Number of write log words batched up and programmed with a single bulk write
+#ifndef WEAR_LEVELING_APPEND_BATCH_COUNT
+#    define WEAR_LEVELING_APPEND_BATCH_COUNT (32 / (BACKING_STORE_WRITE_SIZE))
+#endif
+
+// Number of write log words read with each bulk read during playback
+#ifndef WEAR_LEVELING_PLAYBACK_BUFFER_COUNT
+#    define WEAR_LEVELING_PLAYBACK_BUFFER_COUNT (64 / (BACKING_STORE_WRITE_SIZE))
+#endif
+
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+// Write log position at which consolidation is scheduled for wear_leveling_task(), rather than waiting for the log to fill
+#    ifndef WEAR_LEVELING_CONSOLIDATE_HIGH_WATER
+#        define WEAR_LEVELING_CONSOLIDATE_HIGH_WATER ((WEAR_LEVELING_LOGICAL_SIZE) + 8 + (((WEAR_LEVELING_BACKING_SIZE) - (WEAR_LEVELING_LOGICAL_SIZE) - 8) * 3 / 4))
+#    endif
+// Number of bytes of the cache programmed into the consolidated area per wear_leveling_task() step
+#    ifndef WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE
+#        define WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE 64
+#    endif
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
+
 // Compile-time validation of configurable options
 _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+#ifdef WEAR_LEVELING_DEFERRED_CONSOLIDATION
+_Static_assert(WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Consolidation chunk size must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_CONSOLIDATE_HIGH_WATER < WEAR_LEVELING_BACKING_SIZE, "Consolidation high-water mark must be inside the backing store");
+#endif // WEAR_LEVELING_DEFERRED_CONSOLIDATION
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
@@ -0,0 +1,276 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "process_adaptive_tapping_term.h"
+}
+
+using testing::_;
+using testing::Invoke;
+using report_t = std::array<uint8_t, 32>;
+
+struct Stroke {
+    KeymapKey *key;
+    uint32_t   down;
+    uint32_t   up;
+};
+
+class AdaptiveTappingTerm : public TestFixture {
+   public:
+    AdaptiveTappingTerm() {
+        set_keymap({key_d, key_f, key_j, key_k, key_l});
+        adaptive_tapping_term_reset();
+    }
+
+    uint16_t term_of(KeymapKey &key) {
+        keyrecord_t record = {};
+        record.event.key   = key.position;
+        return get_adaptive_tapping_term(key.code, &record);
+    }
+
+    /* Typing traces are synthesised here rather than recorded: a seeded generator draws how long
+     * each key is held from hold_min to hold_min + hold_spread, and rolls some keys into the next
+     * one. Only D, F, J and K are typed, never the same key twice in a row. */
+    std::vector<Stroke> trace(uint16_t count, uint16_t hold_min, uint16_t hold_spread, bool rolls) {
+        std::vector<KeymapKey *> keys = {&key_d, &key_f, &key_j, &key_k};
+        std::vector<Stroke>      strokes;
+        KeymapKey               *last = nullptr;
+        uint32_t                 now  = 0;
+
+        for (uint16_t i = 0; i < count; i++) {
+            KeymapKey *key;
+            do {
+                key = keys[next(keys.size())];
+            } while (key == last);
+            last          = key;
+            uint32_t hold = hold_min + next(hold_spread);
+            strokes.push_back({key, now, now + hold});
+            now += hold + (rolls && next(3) == 0 ? -(int32_t)next(15) : 20 + next(100));
+        }
+        return strokes;
+    }
+
+    /* Plays a trace back through the matrix, recording what is typed and when mods go down. */
+    void replay(const std::vector<Stroke> &strokes) {
+        struct Event {
+            uint32_t   time;
+            KeymapKey *key;
+            bool       pressed;
+        };
+        std::vector<Event> events;
+        for (auto &stroke : strokes) {
+            events.push_back({stroke.down, stroke.key, true});
+            events.push_back({stroke.up, stroke.key, false});
+        }
+        std::stable_sort(events.begin(), events.end(), [](const Event &a, const Event &b) { return a.time < b.time; });
+
+        TestDriver           driver;
+        std::vector<uint8_t> held;
+        uint8_t              mods  = 0;
+        uint32_t             start = timer_read32();
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            std::vector<uint8_t> keys;
+            for (uint8_t key : report.keys) {
+                if (key != KC_NO) {
+                    keys.push_back(key);
+                    if (std::find(held.begin(), held.end(), key) == held.end()) {
+                        typed.push_back(key);
+                    }
+                }
+            }
+            if (report.mods && !mods) {
+                misfires.push_back(timer_read32() - start);
+            }
+            held = keys;
+            mods = report.mods;
+        }));
+
+        uint32_t time = 0;
+        for (auto &event : events) {
+            if (event.time > time) {
+                idle_for(event.time - time - 1);
+                time = event.time;
+            }
+            if (event.pressed) {
+                event.key->press();
+            } else {
+                event.key->release();
+            }
+            run_one_scan_loop();
+        }
+        idle_for(TAPPING_TERM * 2);
+        VERIFY_AND_CLEAR(driver);
+    }
+
+    std::vector<uint8_t> expected_typing(const std::vector<Stroke> &strokes) {
+        std::vector<uint8_t> keys;
+        for (auto &stroke : strokes) {
+            keys.push_back(stroke.key->code & 0xFF);
+        }
+        return keys;
+    }
+
+    /* How long a mod-tap held on its own takes to send its mod. */
+    uint32_t hold_latency(KeymapKey &key) {
+        TestDriver driver;
+        uint32_t   pressed = timer_read32(), reported = 0;
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            if (report.mods && !reported) {
+                reported = timer_read32();
+            }
+        }));
+        key.press();
+        run_one_scan_loop();
+        idle_for(TAPPING_TERM + 10);
+        key.release();
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+        return reported - pressed;
+    }
+
+    uint32_t next(uint32_t range) {
+        seed = seed * 1664525 + 1013904223;
+        return (seed >> 8) % range;
+    }
+
+    KeymapKey key_d = KeymapKey(0, 3, 0, LCTL_T(KC_D));
+    KeymapKey key_f = KeymapKey(0, 4, 0, LSFT_T(KC_F));
+    KeymapKey key_j = KeymapKey(0, 7, 0, KC_J);
+    KeymapKey key_k = KeymapKey(0, 8, 0, KC_K);
+    KeymapKey key_l = KeymapKey(0, 9, 0, LT(1, KC_L));
+
+    std::vector<uint8_t>  typed;
+    std::vector<uint32_t> misfires;
+    uint32_t              seed = 0x9E3779B9;
+};
+
+TEST_F(AdaptiveTappingTerm, unadapted_keys_use_the_tapping_term) {
+    EXPECT_EQ(term_of(key_d), TAPPING_TERM);
+    EXPECT_EQ(term_of(key_l), TAPPING_TERM);
+    EXPECT_EQ(hold_latency(key_d), TAPPING_TERM);
+}
+
+TEST_F(AdaptiveTappingTerm, fast_typing_brings_holds_forward_without_misfires) {
+    auto strokes = trace(400, 40, 60, true);
+    replay(strokes);
+
+    EXPECT_EQ(typed, expected_typing(strokes));
+    EXPECT_TRUE(misfires.empty());
+
+    uint16_t term = term_of(key_d);
+    std::cout << "fast typing: tapping term " << term << "ms, shift's " << term_of(key_f) << "ms" << std::endl;
+    EXPECT_GE(term, 100);
+    EXPECT_LT(term, 140);
+    EXPECT_LT(hold_latency(key_d), 140);
+    /* The layer-tap was never tapped, and goes by what the other keys did. */
+    EXPECT_LT(term_of(key_l), 140);
+}
+
+TEST_F(AdaptiveTappingTerm, slower_taps_bring_the_tapping_term_back_up) {
+    replay(trace(400, 40, 60, true));
+    uint16_t fast_term = term_of(key_d);
+    typed.clear();
+    misfires.clear();
+
+    /* Tired now, taps held up to just short of TAPPING_TERM. The first few are taken for holds. */
+    auto strokes = trace(400, 100, 90, false);
+    replay(strokes);
+
+    uint32_t end = strokes.back().up;
+    size_t   late = std::count_if(misfires.begin(), misfires.end(), [&](uint32_t time) { return time > end / 2; });
+    std::cout << "slower typing: " << misfires.size() << " taps taken for holds, " << late << " in the second half, tapping term " << fast_term << "ms -> " << term_of(key_d) << "ms" << std::endl;
+    EXPECT_GT(term_of(key_d), fast_term);
+    EXPECT_GT(misfires.size(), 0);
+    EXPECT_LT(misfires.size(), 20);
+    EXPECT_EQ(late, 0);
+}
+
+TEST_F(AdaptiveTappingTerm, each_key_adapts_to_its_own_taps) {
+    std::vector<Stroke> strokes;
+    uint32_t            now = 0;
+    for (uint16_t i = 0; i < 200; i++) {
+        bool     ctrl = i % 2 == 0;
+        uint32_t hold = ctrl ? 40 + next(20) : 120 + next(30);
+        strokes.push_back({ctrl ? &key_d : &key_f, now, now + hold});
+        strokes.push_back({&key_j, now + hold + 20, now + hold + 60});
+        now += hold + 100 + next(50);
+    }
+    replay(strokes);
+
+    EXPECT_EQ(typed, expected_typing(strokes));
+    std::cout << "ctrl " << term_of(key_d) << "ms, shift " << term_of(key_f) << "ms" << std::endl;
+    EXPECT_EQ(term_of(key_d), 100);
+    EXPECT_GT(term_of(key_f), 150);
+}
+
+/* The raw HID endpoint, as a host tool would query it. */
+class AdaptiveTappingTermRawHid : public AdaptiveTappingTerm {
+   public:
+    report_t request(std::vector<uint8_t> bytes) {
+        report_t report{};
+        std::copy(bytes.begin(), bytes.end(), report.begin());
+        EXPECT_TRUE(adaptive_tapping_term_raw_hid_receive(report.data(), report.size()));
+        return report;
+    }
+};
+
+TEST_F(AdaptiveTappingTermRawHid, reports_settings_and_statistics) {
+    report_t info = request({ADAPTIVE_TAPPING_TERM_RAW_HID_ID, id_adaptive_tapping_term_info});
+    EXPECT_EQ(info[2], ADAPTIVE_TAPPING_TERM_KEYS);
+    EXPECT_EQ(info[3], ADAPTIVE_TAPPING_TERM_BINS);
+    EXPECT_EQ(info[4] << 8 | info[5], ADAPTIVE_TAPPING_TERM_MIN);
+    EXPECT_EQ(info[6] << 8 | info[7], TAPPING_TERM);
+    EXPECT_EQ(info[8], ADAPTIVE_TAPPING_TERM_PERCENTILE);
+
+    auto strokes = trace(200, 40, 60, true);
+    replay(strokes);
+    size_t ctrl_taps = std::count_if(strokes.begin(), strokes.end(), [&](const Stroke &stroke) { return stroke.key == &key_d; });
+    size_t all_taps  = std::count_if(strokes.begin(), strokes.end(), [&](const Stroke &stroke) { return stroke.key == &key_d || stroke.key == &key_f; });
+
+    bool found = false;
+    for (uint8_t i = 0; i < ADAPTIVE_TAPPING_TERM_KEYS; i++) {
+        report_t key = request({ADAPTIVE_TAPPING_TERM_RAW_HID_ID, id_adaptive_tapping_term_get, i});
+        if (key[3] && key[4] == key_d.position.row && key[5] == key_d.position.col) {
+            found          = true;
+            uint16_t total = 0;
+            for (uint8_t bin = 0; bin < ADAPTIVE_TAPPING_TERM_BINS; bin++) {
+                total += key[9 + bin];
+            }
+            EXPECT_EQ(key[6] << 8 | key[7], term_of(key_d));
+            EXPECT_EQ(key[8], total);
+            EXPECT_LE(key[8], ctrl_taps);
+            EXPECT_GT(key[8], ctrl_taps / 2);
+            /* Nothing was held under 40ms. */
+            EXPECT_EQ(key[9], 0);
+        }
+    }
+    EXPECT_TRUE(found);
+
+    report_t global = request({ADAPTIVE_TAPPING_TERM_RAW_HID_ID, id_adaptive_tapping_term_get, ADAPTIVE_TAPPING_TERM_GLOBAL});
+    EXPECT_EQ(global[3], true);
+    EXPECT_LE(global[8], all_taps);
+    EXPECT_GT(global[8], ctrl_taps);
+
+    request({ADAPTIVE_TAPPING_TERM_RAW_HID_ID, id_adaptive_tapping_term_reset});
+    EXPECT_EQ(term_of(key_d), TAPPING_TERM);
+    global = request({ADAPTIVE_TAPPING_TERM_RAW_HID_ID, id_adaptive_tapping_term_get, ADAPTIVE_TAPPING_TERM_GLOBAL});
+    EXPECT_EQ(global[6] << 8 | global[7], TAPPING_TERM);
+    EXPECT_EQ(global[8], 0);
+}
+
+TEST_F(AdaptiveTappingTermRawHid, ignores_other_reports_and_refuses_unknown_operations) {
+    report_t report{0x01};
+    EXPECT_FALSE(adaptive_tapping_term_raw_hid_receive(report.data(), report.size()));
+    EXPECT_EQ(request({ADAPTIVE_TAPPING_TERM_RAW_HID_ID, 0x42})[1], 0xFF);
+}
@@ -0,0 +1,241 @@
+// Generated code.
+
+// Autocorrection dictionary (70 entries):
+//   :guage     -> gauge
+//   :the:the:  -> the
+//   :thier     -> their
+//   :ture      -> true
+//   accomodate -> accommodate
+//   acommodate -> accommodate
+//   aparent    -> apparent
+//   aparrent   -> apparent
+//   apparant   -> apparent
+//   apparrent  -> apparent
+//   aquire     -> acquire
+//   becuase    -> because
+//   cauhgt     -> caught
+//   cheif      -> chief
+//   choosen    -> chosen
+//   cieling    -> ceiling
+//   collegue   -> colleague
+//   concensus  -> consensus
+//   contians   -> contains
+//   cosnt      -> const
+//   dervied    -> derived
+//   fales      -> false
+//   fasle      -> false
+//   fitler     -> filter
+//   flase      -> false
+//   foward     -> forward
+//   frequecy   -> frequency
+//   gaurantee  -> guarantee
+//   guaratee   -> guarantee
+//   heigth     -> height
+//   heirarchy  -> hierarchy
+//   inclued    -> include
+//   interator  -> iterator
+//   intput     -> input
+//   invliad    -> invalid
+//   lenght     -> length
+//   liasion    -> liaison
+//   libary     -> library
+//   listner    -> listener
+//   looses:    -> loses
+//   looup      -> lookup
+//   manefist   -> manifest
+//   namesapce  -> namespace
+//   namespcae  -> namespace
+//   occassion  -> occasion
+//   occured    -> occurred
+//   ouptut     -> output
+//   ouput      -> output
+//   overide    -> override
+//   postion    -> position
+//   priviledge -> privilege
+//   psuedo     -> pseudo
+//   recieve    -> receive
+//   refered    -> referred
+//   relevent   -> relevant
+//   repitition -> repetition
+//   retrun     -> return
+//   retun      -> return
+//   reuslt     -> result
+//   reutrn     -> return
+//   saftey     -> safety
+//   seperate   -> separate
+//   singed     -> signed
+//   stirng     -> string
+//   strign     -> string
+//   swithc     -> switch
+//   swtich     -> switch
+//   thresold   -> threshold
+//   udpate     -> update
+//   widht      -> width
+
+#define AUTOCORRECT_MIN_LENGTH 5 // ":ture"
+#define AUTOCORRECT_MAX_LENGTH 10 // "accomodate"
+#define DICTIONARY_SIZE 2547
+#define AUTOCORRECT_AUTOMATON
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x13, 0x00, 0x00, 0x04, 0x3C, 0x00, 0x05, 0x48, 0x00, 0x06, 0x4E, 0x00, 0x07, 0x5D, 0x00, 0x09,
+    0x63, 0x00, 0x0A, 0x75, 0x00, 0x0B, 0x7E, 0x00, 0x0C, 0x84, 0x00, 0x0F, 0x8A, 0x00, 0x10, 0x96,
+    0x00, 0x11, 0x9C, 0x00, 0x12, 0xA2, 0x00, 0x13, 0xAE, 0x00, 0x15, 0xBA, 0x00, 0x16, 0xC0, 0x00,
+    0x17, 0xD2, 0x00, 0x18, 0xD8, 0x00, 0x1A, 0xDE, 0x00, 0x2C, 0xE4, 0x00, 0x03, 0x00, 0x00, 0x06,
+    0xED, 0x00, 0x13, 0xF6, 0x00, 0x14, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x08, 0x05, 0x01, 0x04, 0x00,
+    0x00, 0x04, 0x0B, 0x01, 0x0B, 0x11, 0x01, 0x0C, 0x1A, 0x01, 0x12, 0x20, 0x01, 0x01, 0x00, 0x00,
+    0x08, 0x2C, 0x01, 0x05, 0x00, 0x00, 0x04, 0x32, 0x01, 0x0C, 0x3B, 0x01, 0x0F, 0x41, 0x01, 0x12,
+    0x47, 0x01, 0x15, 0x4D, 0x01, 0x02, 0x00, 0x00, 0x04, 0x53, 0x01, 0x18, 0x59, 0x01, 0x01, 0x00,
+    0x00, 0x08, 0x5F, 0x01, 0x01, 0x00, 0x00, 0x11, 0x65, 0x01, 0x03, 0x00, 0x00, 0x08, 0x71, 0x01,
+    0x0C, 0x77, 0x01, 0x12, 0x83, 0x01, 0x01, 0x00, 0x00, 0x04, 0x89, 0x01, 0x01, 0x00, 0x00, 0x04,
+    0x8F, 0x01, 0x03, 0x00, 0x00, 0x06, 0x95, 0x01, 0x18, 0x9B, 0x01, 0x19, 0xA1, 0x01, 0x03, 0x00,
+    0x00, 0x12, 0xA7, 0x01, 0x15, 0xAD, 0x01, 0x16, 0xB3, 0x01, 0x01, 0x00, 0x00, 0x08, 0xB9, 0x01,
+    0x05, 0x00, 0x00, 0x04, 0xCE, 0x01, 0x08, 0xD4, 0x01, 0x0C, 0xDA, 0x01, 0x17, 0xE0, 0x01, 0x1A,
+    0xE9, 0x01, 0x01, 0x00, 0x00, 0x0B, 0xF2, 0x01, 0x01, 0x00, 0x00, 0x07, 0xF8, 0x01, 0x01, 0x00,
+    0x00, 0x0C, 0xFE, 0x01, 0x02, 0x00, 0x00, 0x0A, 0x04, 0x02, 0x17, 0x0A, 0x02, 0x02, 0x4E, 0x00,
+    0x06, 0x13, 0x02, 0x12, 0x19, 0x02, 0x02, 0xAE, 0x00, 0x04, 0x1F, 0x02, 0x13, 0x25, 0x02, 0x01,
+    0x00, 0x00, 0x18, 0x2B, 0x02, 0x01, 0x00, 0x00, 0x06, 0x31, 0x02, 0x01, 0x3C, 0x00, 0x18, 0x37,
+    0x02, 0x02, 0x7E, 0x00, 0x08, 0x3D, 0x02, 0x12, 0x43, 0x02, 0x01, 0x84, 0x00, 0x08, 0x49, 0x02,
+    0x03, 0xA2, 0x00, 0x0F, 0x4F, 0x02, 0x11, 0x55, 0x02, 0x16, 0x5E, 0x02, 0x01, 0x00, 0x00, 0x15,
+    0x64, 0x02, 0x02, 0x3C, 0x00, 0x0F, 0x6A, 0x02, 0x16, 0x70, 0x02, 0x01, 0x84, 0x00, 0x17, 0x76,
+    0x02, 0x01, 0x8A, 0x00, 0x04, 0x7C, 0x02, 0x01, 0xA2, 0x00, 0x1A, 0x82, 0x02, 0x01, 0xBA, 0x00,
+    0x08, 0x88, 0x02, 0x01, 0x3C, 0x00, 0x18, 0x8E, 0x02, 0x01, 0xD8, 0x00, 0x04, 0x94, 0x02, 0x01,
+    0x00, 0x00, 0x0C, 0x9A, 0x02, 0x03, 0x9C, 0x00, 0x06, 0xA3, 0x02, 0x17, 0xA9, 0x02, 0x19, 0xB2,
+    0x02, 0x01, 0x00, 0x00, 0x11, 0xB8, 0x02, 0x03, 0x84, 0x00, 0x04, 0xBE, 0x02, 0x05, 0xC4, 0x02,
+    0x16, 0xCA, 0x02, 0x01, 0xA2, 0x00, 0x12, 0xD0, 0x02, 0x01, 0x3C, 0x00, 0x11, 0xD9, 0x02, 0x01,
+    0x3C, 0x00, 0x10, 0xDF, 0x02, 0x01, 0x4E, 0x00, 0x06, 0xE5, 0x02, 0x01, 0xD8, 0x00, 0x13, 0xEE,
+    0x02, 0x01, 0x00, 0x00, 0x08, 0xF7, 0x02, 0x01, 0xA2, 0x00, 0x16, 0xFD, 0x02, 0x01, 0xBA, 0x00,
+    0x0C, 0x03, 0x03, 0x01, 0xC0, 0x00, 0x18, 0x09, 0x03, 0x06, 0x00, 0x00, 0x06, 0x0F, 0x03, 0x09,
+    0x15, 0x03, 0x0F, 0x1B, 0x03, 0x13, 0x21, 0x03, 0x17, 0x27, 0x03, 0x18, 0x30, 0x03, 0x01, 0x3C,
+    0x00, 0x09, 0x39, 0x03, 0x01, 0x00, 0x00, 0x13, 0x3F, 0x03, 0x01, 0x84, 0x00, 0x11, 0x45, 0x03,
+    0x02, 0xD2, 0x00, 0x0C, 0x4B, 0x03, 0x15, 0x51, 0x03, 0x02, 0xDE, 0x00, 0x0C, 0x57, 0x03, 0x17,
+    0x5D, 0x03, 0x01, 0x7E, 0x00, 0x15, 0x63, 0x03, 0x01, 0x5D, 0x00, 0x13, 0x69, 0x03, 0x01, 0x84,
+    0x00, 0x07, 0x6F, 0x03, 0x01, 0x75, 0x00, 0x18, 0x75, 0x03, 0x02, 0xD2, 0x00, 0x0B, 0x7B, 0x03,
+    0x18, 0x84, 0x03, 0x01, 0x4E, 0x00, 0x12, 0x8A, 0x03, 0x01, 0x20, 0x01, 0x10, 0x90, 0x03, 0x01,
+    0x3C, 0x00, 0x15, 0x96, 0x03, 0x01, 0xAE, 0x00, 0x04, 0x9F, 0x03, 0x01, 0xD8, 0x00, 0x0C, 0xA5,
+    0x03, 0x01, 0x4E, 0x00, 0x18, 0xAB, 0x03, 0x01, 0xD8, 0x00, 0x0B, 0xB1, 0x03, 0x01, 0x5F, 0x01,
+    0x0C, 0xB7, 0x03, 0x01, 0xA2, 0x00, 0x12, 0xBD, 0x03, 0x01, 0x00, 0x00, 0x0F, 0xC3, 0x03, 0x01,
+    0x8A, 0x00, 0x0F, 0xC9, 0x03, 0x02, 0x9C, 0x00, 0x06, 0xCF, 0x03, 0x17, 0xD5, 0x03, 0x01, 0xC0,
+    0x00, 0x11, 0xDB, 0x03, 0x01, 0xBA, 0x00, 0x19, 0xE1, 0x03, 0x01, 0x8A, 0x00, 0x08, 0xE7, 0x03,
+    0x01, 0xC0, 0x00, 0x0F, 0xED, 0x03, 0x01, 0xD2, 0x00, 0x0F, 0xF3, 0x03, 0x01, 0x3C, 0x00, 0x16,
+    0xF9, 0x03, 0x01, 0xDE, 0x00, 0x04, 0xFF, 0x03, 0x01, 0xB9, 0x01, 0x14, 0x05, 0x04, 0x01, 0xD8,
+    0x00, 0x15, 0x0B, 0x04, 0x01, 0x3C, 0x00, 0x15, 0x11, 0x04, 0x02, 0x84, 0x00, 0x0A, 0x17, 0x04,
+    0x15, 0x1D, 0x04, 0x01, 0x4E, 0x00, 0x0F, 0x23, 0x04, 0x02, 0xD2, 0x00, 0x08, 0x29, 0x04, 0x13,
+    0x2F, 0x04, 0x01, 0x00, 0x00, 0x0F, 0x35, 0x04, 0x01, 0x9C, 0x00, 0x0A, 0x3B, 0x04, 0x01, 0x3C,
+    0x00, 0x16, 0x41, 0x04, 0x01, 0x48, 0x00, 0x04, 0x47, 0x04, 0x01, 0xC0, 0x00, 0x17, 0x4D, 0x04,
+    0x02, 0xA2, 0x00, 0x16, 0x53, 0x04, 0x18, 0x59, 0x04, 0x01, 0x9C, 0x00, 0x08, 0x5F, 0x04, 0x01,
+    0x96, 0x00, 0x08, 0x65, 0x04, 0x02, 0x4E, 0x00, 0x04, 0x6B, 0x04, 0x18, 0x71, 0x04, 0x02, 0xAE,
+    0x00, 0x17, 0x77, 0x04, 0x18, 0x7D, 0x04, 0x01, 0x00, 0x00, 0x15, 0x83, 0x04, 0x01, 0xC0, 0x00,
+    0x17, 0x89, 0x04, 0x01, 0x84, 0x00, 0x19, 0x8F, 0x04, 0x01, 0xD8, 0x00, 0x08, 0x95, 0x04, 0x01,
+    0x4E, 0x00, 0x0C, 0x9B, 0x04, 0x01, 0x63, 0x00, 0x08, 0xA1, 0x04, 0x01, 0x8A, 0x00, 0x08, 0xA7,
+    0x04, 0x01, 0xAE, 0x00, 0x0C, 0xAD, 0x04, 0x02, 0xD2, 0x00, 0x15, 0xB3, 0x04, 0x18, 0xB9, 0x04,
+    0x02, 0xD8, 0x00, 0x16, 0xBF, 0x04, 0x17, 0xC5, 0x04, 0x01, 0x63, 0x00, 0x17, 0xCB, 0x04, 0x01,
+    0xAE, 0x00, 0x08, 0xD1, 0x04, 0x01, 0x65, 0x01, 0x0A, 0xD7, 0x04, 0x01, 0x84, 0x00, 0x15, 0xDD,
+    0x04, 0x01, 0xBA, 0x00, 0x0C, 0xE3, 0x04, 0x01, 0xFE, 0x01, 0x17, 0xE9, 0x04, 0x01, 0xD2, 0x00,
+    0x0C, 0xEF, 0x04, 0x01, 0xBA, 0x00, 0x08, 0xF5, 0x04, 0x01, 0xAE, 0x00, 0x04, 0xFB, 0x04, 0x01,
+    0x5D, 0x00, 0x0B, 0x01, 0x05, 0x01, 0x59, 0x01, 0x04, 0x07, 0x05, 0x02, 0xF2, 0x01, 0x08, 0x0D,
+    0x05, 0x0C, 0x13, 0x05, 0x01, 0xD8, 0x00, 0x15, 0x19, 0x05, 0x01, 0x20, 0x01, 0x10, 0x1F, 0x05,
+    0x01, 0x96, 0x00, 0x10, 0x25, 0x05, 0x02, 0xBA, 0x00, 0x08, 0x2B, 0x05, 0x15, 0x31, 0x05, 0x01,
+    0x3C, 0x00, 0x15, 0x37, 0x05, 0x01, 0x84, 0x00, 0x15, 0x40, 0x05, 0x01, 0xD8, 0x00, 0x04, 0x46,
+    0x05, 0x01, 0x7E, 0x00, 0x0A, 0x4C, 0x05, 0x01, 0x9A, 0x02, 0x09, 0x52, 0x05, 0x01, 0xA2, 0x00,
+    0x16, 0x57, 0x05, 0x01, 0x8A, 0x00, 0x0C, 0x5D, 0x05, 0x01, 0x8A, 0x00, 0x08, 0x63, 0x05, 0x01,
+    0x4E, 0x00, 0x08, 0x69, 0x05, 0x01, 0xD2, 0x00, 0x0C, 0x6F, 0x05, 0x01, 0x9C, 0x00, 0x17, 0x75,
+    0x05, 0x01, 0x00, 0x00, 0x0C, 0x7A, 0x05, 0x01, 0x71, 0x01, 0x16, 0x80, 0x05, 0x01, 0x8A, 0x00,
+    0x08, 0x84, 0x05, 0x01, 0x8A, 0x00, 0x08, 0x89, 0x05, 0x01, 0xC0, 0x00, 0x08, 0x8F, 0x05, 0x01,
+    0x3C, 0x00, 0x15, 0x95, 0x05, 0x01, 0x00, 0x00, 0x18, 0x9B, 0x05, 0x01, 0xBA, 0x00, 0x04, 0xA1,
+    0x05, 0x01, 0xBA, 0x00, 0x04, 0xA7, 0x05, 0x01, 0x75, 0x00, 0x17, 0xAD, 0x05, 0x01, 0xBA, 0x00,
+    0x04, 0xB3, 0x05, 0x01, 0x8A, 0x00, 0x18, 0xB9, 0x05, 0x01, 0x00, 0x00, 0x15, 0xBF, 0x05, 0x01,
+    0xAE, 0x00, 0x18, 0xC5, 0x05, 0x01, 0x8A, 0x00, 0x0C, 0xCB, 0x05, 0x01, 0x75, 0x00, 0x0B, 0xD1,
+    0x05, 0x01, 0xC0, 0x00, 0x0C, 0xD7, 0x05, 0x01, 0x3C, 0x00, 0x15, 0xDD, 0x05, 0x01, 0xE0, 0x01,
+    0x11, 0xE3, 0x05, 0x01, 0xC0, 0x00, 0x08, 0xE9, 0x05, 0x01, 0x9B, 0x01, 0x13, 0xEF, 0x05, 0x01,
+    0x00, 0x00, 0x09, 0xF4, 0x05, 0x01, 0x00, 0x00, 0x16, 0xFA, 0x05, 0x01, 0x0B, 0x01, 0x16, 0x03,
+    0x06, 0x01, 0xD8, 0x00, 0x15, 0x09, 0x06, 0x01, 0xD2, 0x00, 0x18, 0x0F, 0x06, 0x01, 0xD8, 0x00,
+    0x17, 0x15, 0x06, 0x01, 0xBA, 0x00, 0x0C, 0x1B, 0x06, 0x01, 0xE0, 0x01, 0x0C, 0x21, 0x06, 0x01,
+    0x00, 0x00, 0x0C, 0x27, 0x06, 0x01, 0x00, 0x00, 0x07, 0x2D, 0x06, 0x01, 0x1A, 0x01, 0x08, 0x33,
+    0x06, 0x01, 0x00, 0x00, 0x15, 0x39, 0x06, 0x01, 0x71, 0x01, 0x19, 0x3F, 0x06, 0x01, 0x84, 0x00,
+    0x17, 0x45, 0x06, 0x01, 0xBA, 0x00, 0x18, 0x4B, 0x06, 0x01, 0xD8, 0x00, 0x11, 0x51, 0x06, 0x01,
+    0xC0, 0x00, 0x0F, 0x55, 0x06, 0x01, 0xD2, 0x00, 0x15, 0x5B, 0x06, 0x01, 0xD2, 0x00, 0x08, 0x61,
+    0x06, 0x01, 0x00, 0x00, 0x15, 0x67, 0x06, 0x01, 0x75, 0x00, 0x08, 0x6D, 0x06, 0x01, 0xBA, 0x00,
+    0x11, 0x73, 0x06, 0x01, 0x84, 0x00, 0x0A, 0x79, 0x06, 0x01, 0xD2, 0x00, 0x0B, 0x7F, 0x06, 0x01,
+    0x84, 0x00, 0x06, 0x85, 0x06, 0x01, 0xB9, 0x01, 0x16, 0x8B, 0x06, 0x01, 0x3C, 0x00, 0x17, 0x91,
+    0x06, 0x01, 0x7E, 0x00, 0x17, 0x97, 0x06, 0x01, 0x94, 0x02, 0x0A, 0x9B, 0x06, 0x01, 0x5F, 0x01,
+    0x2C, 0xA1, 0x06, 0x01, 0x84, 0x00, 0x08, 0xA7, 0x06, 0x01, 0xBA, 0x00, 0x08, 0xAD, 0x06, 0x01,
+    0x96, 0x00, 0x12, 0xB2, 0x06, 0x01, 0x96, 0x00, 0x12, 0xB8, 0x06, 0x01, 0xB9, 0x01, 0x11, 0xBE,
+    0x06, 0x01, 0xBA, 0x00, 0x08, 0xC4, 0x06, 0x02, 0xBA, 0x00, 0x04, 0xCA, 0x06, 0x15, 0xD0, 0x06,
+    0x01, 0xBA, 0x00, 0x08, 0xD6, 0x06, 0x01, 0x3C, 0x00, 0x16, 0xDE, 0x06, 0x01, 0x75, 0x00, 0x17,
+    0xE4, 0x06, 0x82, 0x69, 0x65, 0x66, 0x00, 0x01, 0xC0, 0x00, 0x08, 0xE9, 0x06, 0x01, 0x77, 0x01,
+    0x11, 0xEF, 0x06, 0x01, 0x71, 0x01, 0x0A, 0xF5, 0x06, 0x01, 0x00, 0x00, 0x11, 0xFB, 0x06, 0x01,
+    0x84, 0x00, 0x04, 0x01, 0x07, 0x82, 0x6E, 0x73, 0x74, 0x00, 0x01, 0x84, 0x00, 0x08, 0x07, 0x07,
+    0x81, 0x73, 0x65, 0x00, 0x82, 0x6C, 0x73, 0x65, 0x00, 0x01, 0x71, 0x01, 0x15, 0x0D, 0x07, 0x83,
+    0x61, 0x6C, 0x73, 0x65, 0x00, 0x01, 0xBA, 0x00, 0x07, 0x13, 0x07, 0x01, 0xD8, 0x00, 0x08, 0x1A,
+    0x07, 0x01, 0x3C, 0x00, 0x11, 0x20, 0x07, 0x01, 0x3C, 0x00, 0x17, 0x26, 0x07, 0x01, 0xD2, 0x00,
+    0x0B, 0x2C, 0x07, 0x01, 0x3C, 0x00, 0x15, 0x30, 0x07, 0x01, 0xD8, 0x00, 0x08, 0x36, 0x07, 0x01,
+    0xBA, 0x00, 0x04, 0x3C, 0x07, 0x01, 0xD8, 0x00, 0x17, 0x42, 0x07, 0x01, 0x77, 0x01, 0x04, 0x47,
+    0x07, 0x01, 0x7E, 0x00, 0x17, 0x4D, 0x07, 0x01, 0xDA, 0x01, 0x12, 0x51, 0x07, 0x01, 0xBA, 0x00,
+    0x1C, 0x57, 0x07, 0x01, 0x9C, 0x00, 0x08, 0x5D, 0x07, 0x01, 0xD4, 0x01, 0x16, 0x63, 0x07, 0x81,
+    0x6B, 0x75, 0x70, 0x00, 0x01, 0x63, 0x00, 0x0C, 0x69, 0x07, 0x02, 0xC0, 0x00, 0x04, 0x6F, 0x07,
+    0x13, 0x75, 0x07, 0x01, 0xC0, 0x00, 0x16, 0x7B, 0x07, 0x01, 0xBA, 0x00, 0x08, 0x81, 0x07, 0x01,
+    0xD8, 0x00, 0x17, 0x87, 0x07, 0x82, 0x74, 0x70, 0x75, 0x74, 0x00, 0x01, 0x84, 0x00, 0x07, 0x8D,
+    0x07, 0x01, 0x4B, 0x03, 0x12, 0x93, 0x07, 0x01, 0x84, 0x00, 0x0F, 0x99, 0x07, 0x01, 0x5D, 0x00,
+    0x12, 0x9F, 0x07, 0x01, 0x49, 0x02, 0x19, 0xA5, 0x07, 0x01, 0xBA, 0x00, 0x08, 0xAB, 0x07, 0x01,
+    0x00, 0x00, 0x08, 0xB1, 0x07, 0x01, 0xD2, 0x00, 0x0C, 0xB7, 0x07, 0x01, 0xD8, 0x00, 0x11, 0xBD,
+    0x07, 0x80, 0x72, 0x6E, 0x00, 0x01, 0x8A, 0x00, 0x17, 0xC2, 0x07, 0x01, 0xBA, 0x00, 0x11, 0xC8,
+    0x07, 0x01, 0x00, 0x00, 0x1C, 0xCE, 0x07, 0x01, 0xBA, 0x00, 0x04, 0xD3, 0x07, 0x01, 0x00, 0x00,
+    0x07, 0xD9, 0x07, 0x01, 0x9C, 0x00, 0x0A, 0xDF, 0x07, 0x01, 0x75, 0x00, 0x11, 0xE5, 0x07, 0x01,
+    0xF2, 0x01, 0x06, 0xE9, 0x07, 0x01, 0x4E, 0x00, 0x0B, 0xED, 0x07, 0x01, 0xC0, 0x00, 0x12, 0xF3,
+    0x07, 0x01, 0xD2, 0x00, 0x08, 0xF9, 0x07, 0x81, 0x74, 0x68, 0x00, 0x01, 0x75, 0x00, 0x08, 0x00,
+    0x08, 0x01, 0xE4, 0x00, 0x17, 0x06, 0x08, 0x01, 0x00, 0x00, 0x15, 0x0C, 0x08, 0x82, 0x72, 0x75,
+    0x65, 0x00, 0x01, 0xA2, 0x00, 0x07, 0x11, 0x08, 0x01, 0xA2, 0x00, 0x07, 0x17, 0x08, 0x01, 0x9C,
+    0x00, 0x17, 0x1D, 0x08, 0x01, 0xB9, 0x01, 0x11, 0x25, 0x08, 0x01, 0x3C, 0x00, 0x11, 0x2B, 0x08,
+    0x01, 0xBA, 0x00, 0x08, 0x31, 0x08, 0x84, 0x63, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x01, 0xC0,
+    0x00, 0x08, 0x37, 0x08, 0x82, 0x67, 0x68, 0x74, 0x00, 0x01, 0xD4, 0x01, 0x11, 0x3D, 0x08, 0x01,
+    0x65, 0x01, 0x0A, 0x42, 0x08, 0x01, 0x75, 0x00, 0x18, 0x4A, 0x08, 0x01, 0x9C, 0x00, 0x16, 0x50,
+    0x08, 0x01, 0x3C, 0x00, 0x11, 0x56, 0x08, 0x01, 0x00, 0x00, 0x07, 0x5C, 0x08, 0x83, 0x6C, 0x74,
+    0x65, 0x72, 0x00, 0x83, 0x72, 0x77, 0x61, 0x72, 0x64, 0x00, 0x01, 0x00, 0x00, 0x06, 0x62, 0x08,
+    0x01, 0x9C, 0x00, 0x17, 0x68, 0x08, 0x01, 0xD2, 0x00, 0x08, 0x6E, 0x08, 0x81, 0x68, 0x74, 0x00,
+    0x01, 0xBA, 0x00, 0x06, 0x74, 0x08, 0x01, 0x00, 0x00, 0x07, 0x7A, 0x08, 0x01, 0x3C, 0x00, 0x17,
+    0x7E, 0x08, 0x83, 0x70, 0x75, 0x74, 0x00, 0x01, 0xBE, 0x02, 0x07, 0x84, 0x08, 0x81, 0x74, 0x68,
+    0x00, 0x01, 0xA2, 0x00, 0x11, 0x8A, 0x08, 0x82, 0x72, 0x61, 0x72, 0x79, 0x00, 0x01, 0x00, 0x00,
+    0x15, 0x90, 0x08, 0x01, 0xC0, 0x00, 0x2C, 0x96, 0x08, 0x01, 0x3B, 0x01, 0x16, 0x9B, 0x08, 0x01,
+    0xCE, 0x01, 0x13, 0xA1, 0x08, 0x01, 0xAE, 0x00, 0x06, 0xA7, 0x08, 0x01, 0xC0, 0x00, 0x0C, 0xAD,
+    0x08, 0x01, 0xB9, 0x01, 0x07, 0xB3, 0x08, 0x83, 0x74, 0x70, 0x75, 0x74, 0x00, 0x01, 0x5D, 0x00,
+    0x08, 0xB8, 0x08, 0x01, 0xA2, 0x00, 0x11, 0xBE, 0x08, 0x01, 0x8A, 0x00, 0x08, 0xC5, 0x08, 0x83,
+    0x65, 0x75, 0x64, 0x6F, 0x00, 0x01, 0x00, 0x00, 0x08, 0xCB, 0x08, 0x01, 0xB9, 0x01, 0x07, 0xD1,
+    0x08, 0x01, 0x00, 0x00, 0x11, 0xD6, 0x08, 0x01, 0x84, 0x00, 0x17, 0xDC, 0x08, 0x82, 0x75, 0x72,
+    0x6E, 0x00, 0x83, 0x73, 0x75, 0x6C, 0x74, 0x00, 0x83, 0x74, 0x75, 0x72, 0x6E, 0x00, 0x82, 0x65,
+    0x74, 0x79, 0x00, 0x01, 0x3C, 0x00, 0x17, 0xE2, 0x08, 0x83, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x83,
+    0x72, 0x69, 0x6E, 0x67, 0x00, 0x81, 0x6E, 0x67, 0x00, 0x81, 0x63, 0x68, 0x00, 0x83, 0x69, 0x74,
+    0x63, 0x68, 0x00, 0x01, 0xA2, 0x00, 0x0F, 0xE8, 0x08, 0x84, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00,
+    0x83, 0x61, 0x75, 0x67, 0x65, 0x00, 0x01, 0x0A, 0x02, 0x0B, 0xEE, 0x08, 0x82, 0x65, 0x69, 0x72,
+    0x00, 0x01, 0x5D, 0x00, 0x04, 0xF4, 0x08, 0x01, 0x5D, 0x00, 0x04, 0xFA, 0x08, 0x84, 0x70, 0x61,
+    0x72, 0x65, 0x6E, 0x74, 0x00, 0x01, 0x9C, 0x00, 0x17, 0x00, 0x09, 0x01, 0x9C, 0x00, 0x17, 0x08,
+    0x09, 0x01, 0xB9, 0x01, 0x11, 0x0D, 0x09, 0x83, 0x61, 0x75, 0x73, 0x65, 0x00, 0x83, 0x73, 0x65,
+    0x6E, 0x00, 0x85, 0x65, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x00, 0x01, 0x59, 0x01, 0x08, 0x13, 0x09,
+    0x01, 0xC0, 0x00, 0x18, 0x19, 0x09, 0x01, 0x9C, 0x00, 0x16, 0x1F, 0x09, 0x83, 0x69, 0x76, 0x65,
+    0x64, 0x00, 0x01, 0x4E, 0x00, 0x1C, 0x25, 0x09, 0x01, 0xD2, 0x00, 0x08, 0x2A, 0x09, 0x01, 0x00,
+    0x00, 0x08, 0x30, 0x09, 0x01, 0x4E, 0x00, 0x0B, 0x36, 0x09, 0x81, 0x64, 0x65, 0x00, 0x01, 0xD2,
+    0x00, 0x12, 0x3C, 0x09, 0x83, 0x61, 0x6C, 0x69, 0x64, 0x00, 0x83, 0x69, 0x73, 0x6F, 0x6E, 0x00,
+    0x82, 0x65, 0x6E, 0x65, 0x72, 0x00, 0x84, 0x73, 0x65, 0x73, 0x00, 0x01, 0xC0, 0x00, 0x17, 0x42,
+    0x09, 0x01, 0xF6, 0x00, 0x06, 0x49, 0x09, 0x01, 0x4E, 0x00, 0x04, 0x4F, 0x09, 0x01, 0xDA, 0x01,
+    0x12, 0x55, 0x09, 0x81, 0x72, 0x65, 0x64, 0x00, 0x82, 0x72, 0x69, 0x64, 0x65, 0x00, 0x83, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0x00, 0x01, 0x71, 0x01, 0x07, 0x5B, 0x09, 0x83, 0x65, 0x69, 0x76, 0x65,
+    0x00, 0x81, 0x72, 0x65, 0x64, 0x00, 0x01, 0x9C, 0x00, 0x17, 0x61, 0x09, 0x01, 0xD2, 0x00, 0x0C,
+    0x66, 0x09, 0x01, 0xD2, 0x00, 0x08, 0x6C, 0x09, 0x01, 0x8A, 0x00, 0x07, 0x73, 0x09, 0x01, 0x7B,
+    0x03, 0x08, 0x79, 0x09, 0x01, 0x3C, 0x00, 0x17, 0x7F, 0x09, 0x01, 0x3C, 0x00, 0x17, 0x85, 0x09,
+    0x85, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x01, 0x9C, 0x00,
+    0x17, 0x8B, 0x09, 0x82, 0x61, 0x67, 0x75, 0x65, 0x00, 0x01, 0xD8, 0x00, 0x16, 0x90, 0x09, 0x83,
+    0x61, 0x69, 0x6E, 0x73, 0x00, 0x81, 0x6E, 0x63, 0x79, 0x00, 0x01, 0x00, 0x00, 0x08, 0x98, 0x09,
+    0x82, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x01, 0x11, 0x01, 0x1C, 0xA2, 0x09, 0x01, 0xA2, 0x00, 0x15,
+    0xAC, 0x09, 0x84, 0x69, 0x66, 0x65, 0x73, 0x74, 0x00, 0x01, 0x4E, 0x00, 0x08, 0xB5, 0x09, 0x01,
+    0x0B, 0x01, 0x08, 0xBB, 0x09, 0x01, 0xA2, 0x00, 0x11, 0xC0, 0x09, 0x01, 0x5D, 0x00, 0x0A, 0xC5,
+    0x09, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x01, 0x84, 0x00, 0x12, 0xCB, 0x09, 0x84, 0x61, 0x72, 0x61,
+    0x74, 0x65, 0x00, 0x82, 0x68, 0x6F, 0x6C, 0x64, 0x00, 0x01, 0x0D, 0x05, 0x2C, 0xD1, 0x09, 0x01,
+    0xD2, 0x00, 0x08, 0xD3, 0x09, 0x01, 0xD2, 0x00, 0x08, 0xDB, 0x09, 0x83, 0x65, 0x6E, 0x74, 0x00,
+    0x85, 0x73, 0x65, 0x6E, 0x73, 0x75, 0x73, 0x00, 0x87, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65,
+    0x65, 0x00, 0x87, 0x69, 0x65, 0x72, 0x61, 0x72, 0x63, 0x68, 0x79, 0x00, 0x87, 0x74, 0x65, 0x72,
+    0x61, 0x74, 0x6F, 0x72, 0x00, 0x83, 0x70, 0x61, 0x63, 0x65, 0x00, 0x82, 0x61, 0x63, 0x65, 0x00,
+    0x83, 0x69, 0x6F, 0x6E, 0x00, 0x01, 0x75, 0x00, 0x08, 0xE6, 0x09, 0x01, 0xA2, 0x00, 0x11, 0xEA,
+    0x09, 0x84, 0x00, 0x84, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x87, 0x63, 0x6F, 0x6D, 0x6D,
+    0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x82, 0x67, 0x65, 0x00, 0x86, 0x65, 0x74, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x00
+};
@@ -0,0 +1,197 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "process_autocorrect.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+/* The default dictionary as a trie, which this folder's autocorrect_data.h holds as an automaton. */
+namespace trie {
+#include "autocorrect_data_default.h"
+}
+
+struct Correction {
+    size_t      keystroke;
+    uint8_t     backspaces;
+    std::string changes;
+
+    bool operator==(const Correction &other) const {
+        return keystroke == other.keystroke && backspaces == other.backspaces && changes == other.changes;
+    }
+};
+
+static void PrintTo(const Correction &correction, std::ostream *os) {
+    *os << "{" << correction.keystroke << ", " << +correction.backspaces << ", \"" << correction.changes << "\"}";
+}
+
+static bool                    record_corrections = false;
+static size_t                  keystroke          = 0;
+static std::vector<Correction> corrections;
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    if (!record_corrections) {
+        return true;
+    }
+    char changes[64];
+    strcpy_P(changes, str);
+    corrections.push_back({keystroke, backspaces, changes});
+    return false;
+}
+
+/* The buffer handling and backwards trie walk process_autocorrect() does without AUTOCORRECT_AUTOMATON. */
+class TrieReference {
+   public:
+    void press(uint16_t keycode) {
+        switch (keycode) {
+            case KC_A ... KC_Z:
+                break;
+            case KC_1 ... KC_0:
+            case KC_TAB ... KC_SEMICOLON:
+            case KC_GRAVE ... KC_SLASH:
+                keycode = KC_SPC;
+                break;
+            case KC_ENTER:
+                size    = 0;
+                keycode = KC_SPC;
+                break;
+            case KC_BSPC:
+                if (size > 0) {
+                    --size;
+                }
+                return;
+            case KC_QUOTE:
+                break;
+            default:
+                size = 0;
+                return;
+        }
+
+        if (size >= AUTOCORRECT_MAX_LENGTH) {
+            memmove(buffer, buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
+            size = AUTOCORRECT_MAX_LENGTH - 1;
+        }
+        buffer[size++] = keycode;
+        if (size < AUTOCORRECT_MIN_LENGTH) {
+            return;
+        }
+
+        uint16_t state = 0;
+        uint8_t  code  = trie::autocorrect_data[state];
+        for (int8_t i = size - 1; i >= 0; --i) {
+            uint8_t const key_i = buffer[i];
+            if (code & 64) {
+                code &= 63;
+                for (; code != key_i; code = trie::autocorrect_data[state += 3]) {
+                    if (!code) return;
+                }
+                state = trie::autocorrect_data[state + 1] | trie::autocorrect_data[state + 2] << 8;
+            } else if (code != key_i) {
+                return;
+            } else if (!(code = trie::autocorrect_data[++state])) {
+                ++state;
+            }
+
+            code = trie::autocorrect_data[state];
+            if (code & 128) {
+                corrections.push_back({keystroke, (uint8_t)(code & 63), (const char *)&trie::autocorrect_data[state + 1]});
+                if (keycode == KC_SPC) {
+                    buffer[0] = KC_SPC;
+                    size      = 1;
+                } else {
+                    size = 0;
+                }
+                return;
+            }
+        }
+    }
+
+   private:
+    uint8_t buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
+    uint8_t size                                 = 1;
+};
+
+class AutoCorrectAutomaton : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+        record_corrections = true;
+        corrections.clear();
+    }
+
+    void TearDown() override {
+        record_corrections = false;
+    }
+};
+
+/* Types a long pseudo random stream, full of typos from the dictionary, near misses, word breaks and
+ * backspaces, through the firmware and through the trie, and expects the same corrections from both. */
+TEST_F(AutoCorrectAutomaton, corrects_the_same_typos_as_the_trie) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    const std::vector<uint16_t> others = {KC_SPC, KC_SPC, KC_QUOTE, KC_BSPC, KC_BSPC, KC_ENTER, KC_DOT, KC_1, KC_ESC};
+    std::vector<KeymapKey>      keys;
+    for (uint8_t i = 0; i < 26 + others.size(); i++) {
+        keys.push_back(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, i < 26 ? KC_A + i : others[i - 26]));
+        add_key(keys.back());
+    }
+    auto key_for = [&](uint16_t keycode) -> KeymapKey & {
+        for (auto &key : keys) {
+            if (key.code == keycode) return key;
+        }
+        return keys[0];
+    };
+
+    const std::vector<std::string> typos = {"fales", "the the ", "thier ", "ture ", "accomodate", "lenght", "ouptut", "looses ", "becuase", "widht", "fitler", "occured", "aparrent"};
+    std::vector<uint16_t>          stream;
+    uint32_t                       seed = 0x2545F491;
+    auto                           next = [&](uint32_t range) {
+        seed = seed * 1664525 + 1013904223;
+        return (seed >> 8) % range;
+    };
+    while (stream.size() < 20000) {
+        switch (next(4)) {
+            case 0: {
+                /* A typo, possibly cut short or broken by a backspace. */
+                const std::string &typo = typos[next(typos.size())];
+                size_t             cut  = next(3) == 0 ? next(typo.size()) : typo.size();
+                for (size_t i = 0; i < cut; i++) {
+                    stream.push_back(typo[i] == ' ' ? KC_SPC : KC_A + typo[i] - 'a');
+                    if (next(40) == 0) {
+                        stream.push_back(KC_BSPC);
+                    }
+                }
+                break;
+            }
+            case 1:
+                stream.push_back(others[next(others.size())]);
+                break;
+            default:
+                stream.push_back(KC_A + next(26));
+                break;
+        }
+    }
+
+    TrieReference reference;
+    for (keystroke = 0; keystroke < stream.size(); keystroke++) {
+        reference.press(stream[keystroke]);
+    }
+    std::vector<Correction> expected = corrections;
+    corrections.clear();
+
+    for (keystroke = 0; keystroke < stream.size(); keystroke++) {
+        tap_key(key_for(stream[keystroke]));
+    }
+
+    EXPECT_GT(expected.size(), 100);
+    EXPECT_EQ(corrections, expected);
+    VERIFY_AND_CLEAR(driver);
+}
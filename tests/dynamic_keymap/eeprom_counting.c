@@ -0,0 +1,29 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "eeprom_driver.h"
+#include "eeprom_counting.h"
+
+/* RAM backed custom EEPROM driver counting transactions, standing in for an external EEPROM
+ * where every read or write is a bus transfer. */
+static uint8_t buffer[EEPROM_SIZE];
+
+uint32_t eeprom_counting_reads;
+uint32_t eeprom_counting_writes;
+
+void eeprom_driver_init(void) {}
+
+void eeprom_driver_erase(void) {
+    memset(buffer, 0x00, sizeof(buffer));
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_counting_reads++;
+    memcpy(buf, &buffer[(uintptr_t)addr], len);
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    eeprom_counting_writes++;
+    memcpy(&buffer[(uintptr_t)addr], buf, len);
+}
@@ -0,0 +1,18 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of block transfers made through the test EEPROM driver. */
+extern uint32_t eeprom_counting_reads;
+extern uint32_t eeprom_counting_writes;
+
+#ifdef __cplusplus
+}
+#endif
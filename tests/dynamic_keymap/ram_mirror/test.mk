@@ -0,0 +1,12 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+DYNAMIC_KEYMAP_ENABLE = yes
+EEPROM_DRIVER = custom
+
+SRC += tests/dynamic_keymap/eeprom_counting.c
+SRC += tests/dynamic_keymap/test_dynamic_keymap.cpp
@@ -0,0 +1,303 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+#include "eeprom_counting.h"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+#include "keymap_introspection.h"
+}
+
+using testing::_;
+using testing::InvokeWithoutArgs;
+
+class DynamicKeymap : public TestFixture {
+   protected:
+    void SetUp() override {
+        for (uint8_t layer = 0; layer < dynamic_keymap_get_layer_count(); layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    dynamic_keymap_set_keycode(layer, row, col, expected(layer, row, col));
+                }
+            }
+        }
+    }
+
+    static uint16_t expected(uint8_t layer, uint8_t row, uint8_t col) {
+        return KC_A + ((layer * MATRIX_ROWS * MATRIX_COLS + row * MATRIX_COLS + col) % 26) + (layer << 8);
+    }
+
+    /* Write the macros the way VIA does: mark the buffer invalid, fill it in 28 byte chunks, then mark it valid again. */
+    static void set_macros(const std::vector<std::string> &macros) {
+        std::vector<uint8_t> buffer(dynamic_keymap_macro_get_buffer_size(), 0);
+        size_t               offset = 0;
+        for (const auto &macro : macros) {
+            memcpy(&buffer[offset], macro.c_str(), macro.size() + 1);
+            offset += macro.size() + 1;
+        }
+
+        uint8_t invalid = 0xFF, valid = 0;
+        dynamic_keymap_macro_set_buffer(buffer.size() - 1, 1, &invalid);
+        for (offset = 0; offset < buffer.size() - 1; offset += 28) {
+            dynamic_keymap_macro_set_buffer(offset, std::min<size_t>(28, buffer.size() - 1 - offset), &buffer[offset]);
+        }
+        dynamic_keymap_macro_set_buffer(buffer.size() - 1, 1, &valid);
+    }
+
+    /* EEPROM reads made by dynamic_keymap_macro_send() before it sends the first key of a macro starting with 'a'. */
+    static uint32_t reads_before_first_key(uint8_t id) {
+        TestDriver driver;
+        uint32_t   start = eeprom_counting_reads, first = 0;
+
+        EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+        EXPECT_REPORT(driver, (KC_A)).WillOnce(InvokeWithoutArgs([&] { first = eeprom_counting_reads; })).RetiresOnSaturation();
+        dynamic_keymap_macro_send(id);
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return first - start;
+    }
+
+    static uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t col) {
+        const uint8_t *address = (const uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, col);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+};
+
+TEST_F(DynamicKeymap, lookups_match_what_was_stored) {
+    for (uint8_t layer = 0; layer < dynamic_keymap_get_layer_count(); layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                EXPECT_EQ(keycode_at_keymap_location(layer, row, col), expected(layer, row, col));
+                EXPECT_EQ(eeprom_keycode(layer, row, col), expected(layer, row, col));
+            }
+        }
+    }
+    EXPECT_EQ(keycode_at_keymap_location(dynamic_keymap_get_layer_count(), 0, 0), KC_NO);
+}
+
+TEST_F(DynamicKeymap, set_keycode_writes_through) {
+    dynamic_keymap_set_keycode(2, 3, 9, KC_F13);
+    EXPECT_EQ(keycode_at_keymap_location(2, 3, 9), KC_F13);
+    EXPECT_EQ(eeprom_keycode(2, 3, 9), KC_F13);
+    EXPECT_EQ(keycode_at_keymap_location(2, 3, 8), expected(2, 3, 8));
+}
+
+TEST_F(DynamicKeymap, set_buffer_writes_through) {
+    /* Rewrite the tail of layer 0 and the head of layer 1 in one go, big endian. */
+    const uint16_t offset = (MATRIX_ROWS * MATRIX_COLS - 2) * 2;
+    uint8_t        data[8];
+    for (uint8_t i = 0; i < 4; i++) {
+        data[i * 2]     = (KC_F1 + i) >> 8;
+        data[i * 2 + 1] = (KC_F1 + i) & 0xFF;
+    }
+    dynamic_keymap_set_buffer(offset, sizeof(data), data);
+
+    EXPECT_EQ(keycode_at_keymap_location(0, MATRIX_ROWS - 1, MATRIX_COLS - 2), KC_F1);
+    EXPECT_EQ(keycode_at_keymap_location(0, MATRIX_ROWS - 1, MATRIX_COLS - 1), KC_F2);
+    EXPECT_EQ(keycode_at_keymap_location(1, 0, 0), KC_F3);
+    EXPECT_EQ(keycode_at_keymap_location(1, 0, 1), KC_F4);
+    EXPECT_EQ(eeprom_keycode(1, 0, 1), KC_F4);
+
+    uint8_t readback[sizeof(data)];
+    dynamic_keymap_get_buffer(offset, sizeof(readback), readback);
+    EXPECT_EQ(memcmp(readback, data, sizeof(data)), 0);
+
+    /* Reads past the end of the keymaps are padded with zeros. */
+    const uint16_t end = dynamic_keymap_get_layer_count() * MATRIX_ROWS * MATRIX_COLS * 2;
+    dynamic_keymap_get_buffer(end - 2, sizeof(readback), readback);
+    EXPECT_EQ((readback[0] << 8) | readback[1], expected(dynamic_keymap_get_layer_count() - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1));
+    EXPECT_EQ(readback[2], 0);
+    EXPECT_EQ(readback[7], 0);
+}
+
+TEST_F(DynamicKeymap, reset_restores_flash_keymap) {
+    dynamic_keymap_reset();
+    EXPECT_EQ(keycode_at_keymap_location(0, 1, 1), keycode_at_keymap_location_raw(0, 1, 1));
+    EXPECT_EQ(keycode_at_keymap_location(3, 1, 1), keycode_at_keymap_location_raw(3, 1, 1));
+    EXPECT_EQ(eeprom_keycode(3, 1, 1), keycode_at_keymap_location_raw(3, 1, 1));
+}
+
+TEST_F(DynamicKeymap, eeprom_reads_per_lookup) {
+    uint32_t reads = eeprom_counting_reads;
+    keycode_at_keymap_location(1, 2, 3);
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    EXPECT_EQ(eeprom_counting_reads, reads);
+#else
+    EXPECT_EQ(eeprom_counting_reads, reads + 1);
+#endif
+}
+
+TEST_F(DynamicKeymap, full_keymap_sync_is_one_transaction_per_chunk) {
+    /* VIA moves the keymap in 28 byte chunks, the payload of a 32 byte raw HID report. */
+    const uint16_t size   = dynamic_keymap_get_layer_count() * MATRIX_ROWS * MATRIX_COLS * 2;
+    const uint16_t chunk  = 28;
+    const uint16_t chunks = (size + chunk - 1) / chunk;
+    uint8_t        keymap[size + chunk];
+
+    uint32_t reads = eeprom_counting_reads, writes = eeprom_counting_writes;
+    for (uint16_t offset = 0; offset < size; offset += chunk) {
+        dynamic_keymap_get_buffer(offset, chunk, &keymap[offset]);
+    }
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    EXPECT_EQ(eeprom_counting_reads - reads, 0);
+#else
+    EXPECT_EQ(eeprom_counting_reads - reads, chunks);
+#endif
+    EXPECT_EQ(eeprom_counting_writes - writes, 0);
+
+    /* Writing back what is already there reads each chunk to compare, but writes nothing. */
+    reads = eeprom_counting_reads;
+    for (uint16_t offset = 0; offset < size; offset += chunk) {
+        dynamic_keymap_set_buffer(offset, chunk, &keymap[offset]);
+    }
+    EXPECT_EQ(eeprom_counting_reads - reads, chunks);
+    EXPECT_EQ(eeprom_counting_writes - writes, 0);
+
+    /* A changed keymap is written a chunk at a time. */
+    for (uint16_t i = 0; i < size; i++) {
+        keymap[i] ^= 0x5A;
+    }
+    for (uint16_t offset = 0; offset < size; offset += chunk) {
+        dynamic_keymap_set_buffer(offset, chunk, &keymap[offset]);
+    }
+    EXPECT_EQ(eeprom_counting_writes - writes, chunks);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), expected(0, 0, 0) ^ 0x5A5A);
+
+    std::cout << "Full keymap sync of " << size << " bytes: " << chunks << " EEPROM reads, " << chunks << " EEPROM writes" << std::endl;
+}
+
+TEST_F(DynamicKeymap, macro_buffer_is_moved_in_blocks) {
+    uint8_t data[28];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = 'a' + i % 26;
+    }
+
+    uint32_t reads = eeprom_counting_reads, writes = eeprom_counting_writes;
+    dynamic_keymap_macro_set_buffer(0, sizeof(data), data);
+    EXPECT_EQ(eeprom_counting_reads - reads, 1);
+    EXPECT_EQ(eeprom_counting_writes - writes, 1);
+
+    uint8_t readback[sizeof(data)];
+    dynamic_keymap_macro_get_buffer(0, sizeof(readback), readback);
+    EXPECT_EQ(memcmp(readback, data, sizeof(data)), 0);
+
+    /* Reads past the end of the macro buffer are padded with zeros. */
+    dynamic_keymap_macro_get_buffer(dynamic_keymap_macro_get_buffer_size() - 1, sizeof(readback), readback);
+    EXPECT_EQ(readback[1], 0);
+
+    dynamic_keymap_macro_reset();
+    dynamic_keymap_macro_get_buffer(0, sizeof(readback), readback);
+    EXPECT_EQ(readback[0], 0);
+}
+
+TEST_F(DynamicKeymap, macro_send_plays_the_nth_macro) {
+    TestDriver driver;
+    set_macros({"ab", "", "c"});
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    dynamic_keymap_macro_send(2);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Empty and missing macros send nothing. */
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(1);
+    dynamic_keymap_macro_send(3);
+    dynamic_keymap_macro_send(dynamic_keymap_macro_get_count());
+    VERIFY_AND_CLEAR(driver);
+
+    /* Rewriting the first macro moves the ones after it. */
+    set_macros({"abcd", "", "b"});
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    dynamic_keymap_macro_send(2);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Nothing is sent while the buffer is marked as being written. */
+    uint8_t invalid = 0xFF;
+    dynamic_keymap_macro_set_buffer(dynamic_keymap_macro_get_buffer_size() - 1, 1, &invalid);
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymap, macro_send_starts_in_constant_time) {
+    std::vector<std::string> macros(dynamic_keymap_macro_get_count(), std::string(30, 'x'));
+    for (auto &macro : macros) {
+        macro[0] = 'a';
+    }
+    set_macros(macros);
+
+    /* The first playback after the buffer is written finds where the macros start, */
+    const uint8_t last  = dynamic_keymap_macro_get_count() - 1;
+    uint32_t      cold  = reads_before_first_key(last);
+    uint32_t      first = reads_before_first_key(0);
+    uint32_t      warm  = reads_before_first_key(last);
+
+    /* after which reaching any macro takes the same reads: the valid flag and the first byte. */
+    EXPECT_EQ(first, 2);
+    EXPECT_EQ(warm, 2);
+    EXPECT_GT(cold, warm);
+
+    /* Writing a macro only forgets where the ones after it start. */
+    dynamic_keymap_macro_set_buffer(last * 31 + 1, 1, (uint8_t *)"y");
+    EXPECT_EQ(reads_before_first_key(last), 2);
+    dynamic_keymap_macro_set_buffer(1, 1, (uint8_t *)"y");
+    EXPECT_EQ(reads_before_first_key(0), 2);
+    EXPECT_GT(reads_before_first_key(last), 2);
+    EXPECT_EQ(reads_before_first_key(last), 2);
+
+    std::cout << "Macro " << +last << " of " << +dynamic_keymap_macro_get_count() << ": " << cold << " EEPROM reads before the first key after a write, " << warm << " after" << std::endl;
+}
+
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+TEST_F(DynamicKeymap, mirror_is_loaded_in_one_read) {
+    uint32_t reads = eeprom_counting_reads;
+    dynamic_keymap_init();
+    EXPECT_EQ(eeprom_counting_reads, reads + 1);
+}
+
+TEST_F(DynamicKeymap, lookups_do_not_read_eeprom) {
+    /* Changing the EEPROM behind dynamic_keymap's back is only seen once the mirror is reloaded. */
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(1, 2, 3);
+    eeprom_update_byte(address + 1, KC_Z);
+    EXPECT_EQ(keycode_at_keymap_location(1, 2, 3), expected(1, 2, 3));
+
+    dynamic_keymap_init();
+    EXPECT_EQ(keycode_at_keymap_location(1, 2, 3), (expected(1, 2, 3) & 0xFF00) | KC_Z);
+}
+#endif
+
+/* Not a pass/fail benchmark, prints the cost of resolving a key the way layer_switch_get_layer()
+ * does with every layer active, so builds with and without DYNAMIC_KEYMAP_RAM_MIRROR can be compared. */
+TEST_F(DynamicKeymap, lookup_time_report) {
+    const unsigned    rounds = 2000;
+    volatile uint16_t sink   = 0;
+    uint32_t          reads  = eeprom_counting_reads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned round = 0; round < rounds; round++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                for (int8_t layer = dynamic_keymap_get_layer_count() - 1; layer >= 0; layer--) {
+                    sink = sink + keycode_at_keymap_location(layer, row, col);
+                }
+            }
+        }
+    }
+    double elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    double lookups    = (double)rounds * MATRIX_ROWS * MATRIX_COLS * dynamic_keymap_get_layer_count();
+
+    std::cout << "Keymap lookup";
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    std::cout << " with DYNAMIC_KEYMAP_RAM_MIRROR";
+#endif
+    std::cout << ": " << std::fixed << std::setprecision(2) << elapsed_ns / lookups << "ns, " << (eeprom_counting_reads - reads) / lookups << " EEPROM reads" << std::endl;
+}
@@ -0,0 +1,145 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iostream>
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+#include "tests/dynamic_keymap/eeprom_counting.h"
+
+extern "C" {
+#include "eeconfig.h"
+#include "eeprom.h"
+#include "suspend.h"
+}
+
+using testing::_;
+
+#ifndef EECONFIG_FLUSH_DELAY
+#    define EECONFIG_FLUSH_DELAY 1000
+#endif
+
+class Eeconfig : public TestFixture {
+   protected:
+    void SetUp() override {
+        eeconfig_flush();
+    }
+
+    /* What is actually stored, bypassing any cache. */
+    static uint16_t stored_keymap(void) {
+        return eeprom_read_word(EECONFIG_KEYMAP);
+    }
+    static uint8_t stored_debug(void) {
+        return eeprom_read_byte(EECONFIG_DEBUG);
+    }
+};
+
+TEST_F(Eeconfig, values_read_back) {
+    eeconfig_update_keymap(0x1234);
+    eeconfig_update_debug(0xA5);
+    EXPECT_EQ(eeconfig_read_keymap(), 0x1234);
+    EXPECT_EQ(eeconfig_read_debug(), 0xA5);
+
+    uint8_t data[EECONFIG_USER_DATA_SIZE], readback[EECONFIG_USER_DATA_SIZE];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = i * 7;
+    }
+    eeconfig_update_user_datablock(data);
+    eeconfig_read_user_datablock(readback);
+    EXPECT_EQ(memcmp(data, readback, sizeof(data)), 0);
+    EXPECT_TRUE(eeconfig_is_user_datablock_valid());
+}
+
+TEST_F(Eeconfig, repeated_adjustment_writes) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    /* A value held down for two seconds, changing every scan loop the way a hue key repeats. */
+    uint32_t writes = eeprom_counting_writes;
+    for (uint16_t i = 0; i < 200; i++) {
+        eeconfig_update_debug(i);
+        idle_for(10);
+    }
+    uint32_t adjusting = eeprom_counting_writes - writes;
+
+    idle_for(EECONFIG_FLUSH_DELAY);
+    EXPECT_EQ(stored_debug(), 199);
+#ifdef EECONFIG_WRITE_BACK_CACHE
+    /* One write per flush delay, rather than one per change. */
+    EXPECT_LE(adjusting, 2000 / EECONFIG_FLUSH_DELAY + 1);
+    std::cout << "200 adjustments with EECONFIG_WRITE_BACK_CACHE: " << eeprom_counting_writes - writes << " EEPROM writes" << std::endl;
+#else
+    EXPECT_EQ(adjusting, 200);
+    std::cout << "200 adjustments: " << eeprom_counting_writes - writes << " EEPROM writes" << std::endl;
+#endif
+}
+
+TEST_F(Eeconfig, only_dirty_regions_are_written) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    eeconfig_update_keymap(0x0001);
+    eeconfig_update_debug(0x0002);
+    idle_for(EECONFIG_FLUSH_DELAY * 2);
+
+    uint32_t writes = eeprom_counting_writes;
+    eeconfig_update_keymap(0x0003);
+    eeconfig_update_keymap(0x0004);
+    eeconfig_update_debug(0x0002);
+    idle_for(EECONFIG_FLUSH_DELAY * 2);
+#ifdef EECONFIG_WRITE_BACK_CACHE
+    EXPECT_EQ(eeprom_counting_writes - writes, 1);
+#else
+    EXPECT_EQ(eeprom_counting_writes - writes, 2);
+#endif
+    EXPECT_EQ(stored_keymap(), 0x0004);
+    EXPECT_EQ(stored_debug(), 0x0002);
+}
+
+#ifdef EECONFIG_WRITE_BACK_CACHE
+TEST_F(Eeconfig, writes_wait_for_flush_delay) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    uint32_t writes = eeprom_counting_writes;
+    eeconfig_update_keymap(0x5555);
+    EXPECT_EQ(eeprom_counting_writes, writes);
+    EXPECT_NE(stored_keymap(), 0x5555);
+
+    idle_for(EECONFIG_FLUSH_DELAY / 2);
+    EXPECT_EQ(eeprom_counting_writes, writes);
+
+    idle_for(EECONFIG_FLUSH_DELAY);
+    EXPECT_EQ(eeprom_counting_writes, writes + 1);
+    EXPECT_EQ(stored_keymap(), 0x5555);
+}
+
+TEST_F(Eeconfig, suspend_flushes) {
+    eeconfig_update_keymap(0x6666);
+    EXPECT_NE(stored_keymap(), 0x6666);
+    suspend_power_down_quantum();
+    EXPECT_EQ(stored_keymap(), 0x6666);
+}
+
+TEST_F(Eeconfig, bootloader_jump_flushes) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+
+    eeconfig_update_keymap(0x7777);
+    eeconfig_update_debug(0x88);
+    EXPECT_NE(stored_keymap(), 0x7777);
+    reset_keyboard();
+    EXPECT_EQ(stored_keymap(), 0x7777);
+    EXPECT_EQ(stored_debug(), 0x88);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Eeconfig, reads_are_served_from_ram) {
+    eeconfig_read_keymap();
+    uint32_t reads = eeprom_counting_reads;
+    for (uint8_t i = 0; i < 100; i++) {
+        eeconfig_read_keymap();
+        eeconfig_read_debug();
+    }
+    EXPECT_EQ(eeprom_counting_reads, reads);
+}
+#endif
@@ -0,0 +1,13 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define EEPROM_SIZE 1024
+
+#define EECONFIG_USER_DATA_SIZE 16
+
+#define EECONFIG_WRITE_BACK_CACHE
+#define EECONFIG_FLUSH_DELAY 1000
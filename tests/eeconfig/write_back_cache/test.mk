@@ -0,0 +1,11 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+EEPROM_DRIVER = custom
+
+SRC += tests/dynamic_keymap/eeprom_counting.c
+SRC += tests/eeconfig/test_eeconfig.cpp
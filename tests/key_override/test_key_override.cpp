@@ -0,0 +1,251 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdint>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+#include "process_key_override.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+/* Lets tests swap in a generated set of key overrides, and counts how many are looked at. */
+static std::vector<const key_override_t *> generated_overrides;
+static bool                                use_generated = false;
+static uint32_t                            override_gets = 0;
+static std::vector<uintptr_t>              activations;
+
+extern "C" uint16_t key_override_count(void) {
+    return use_generated ? generated_overrides.size() : key_override_count_raw();
+}
+
+extern "C" const key_override_t *key_override_get(uint16_t key_override_idx) {
+    override_gets++;
+    if (!use_generated) {
+        return key_override_get_raw(key_override_idx);
+    }
+    return key_override_idx < generated_overrides.size() ? generated_overrides[key_override_idx] : NULL;
+}
+
+static bool record_activation(bool activated, void *context) {
+    if (activated) {
+        activations.push_back((uintptr_t)context);
+    }
+    return false;
+}
+
+static const uint8_t mod_masks[] = {MOD_BIT(KC_LCTL), MOD_BIT(KC_LSFT), MOD_BIT(KC_LALT), MOD_BIT(KC_LGUI), MOD_BIT(KC_LCTL) | MOD_BIT(KC_LSFT), MOD_BIT(KC_LCTL) | MOD_BIT(KC_LALT)};
+
+class KeyOverride : public TestFixture {
+   public:
+    KeyOverride() {
+        for (uint8_t i = 0; i < 26; i++) {
+            letters.push_back(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, KC_A + i));
+        }
+        for (uint8_t i = 0; i < 4; i++) {
+            mods.push_back(KeymapKey(0, 6 + i, 3, KC_LCTL + i));
+        }
+        for (auto &key : letters) {
+            add_key(key);
+        }
+        for (auto &key : mods) {
+            add_key(key);
+        }
+    }
+
+    ~KeyOverride() {
+        use_generated = false;
+        key_override_init();
+    }
+
+    /* Replace the keymap's overrides with count generated ones, every letter with each mod mask in turn. */
+    void generate(uint16_t count, uint16_t never_matching = 0) {
+        storage.assign(count + never_matching, key_override_t{});
+        generated_overrides.clear();
+        for (uint16_t i = 0; i < storage.size(); i++) {
+            key_override_t &override = storage[i];
+            override.trigger         = KC_A + i % 26;
+            override.trigger_mods    = mod_masks[(i / 26) % sizeof(mod_masks)];
+            override.layers          = i < count ? ~0 : 0;
+            override.suppressed_mods = override.trigger_mods;
+            override.replacement     = KC_NO;
+            override.options         = ko_options_default;
+            override.custom_action   = record_activation;
+            override.context         = (void *)(uintptr_t)i;
+            generated_overrides.push_back(&override);
+        }
+        use_generated = true;
+        key_override_init();
+    }
+
+    /* Type every letter with each mod mask held, then with the letter held before the mods. */
+    void type_everything() {
+        for (uint8_t mask : mod_masks) {
+            for (uint8_t i = 0; i < 4; i++) {
+                if (mask & (1 << i)) {
+                    mods[i].press();
+                    run_one_scan_loop();
+                }
+            }
+            for (auto &letter : letters) {
+                tap_key(letter);
+            }
+            for (uint8_t i = 0; i < 4; i++) {
+                if (mask & (1 << i)) {
+                    mods[i].release();
+                    run_one_scan_loop();
+                }
+            }
+            for (uint8_t letter = 0; letter < letters.size(); letter += 5) {
+                letters[letter].press();
+                run_one_scan_loop();
+                for (uint8_t i = 0; i < 4; i++) {
+                    if (mask & (1 << i)) {
+                        mods[i].press();
+                        run_one_scan_loop();
+                    }
+                }
+                for (uint8_t i = 0; i < 4; i++) {
+                    if (mask & (1 << i)) {
+                        mods[i].release();
+                        run_one_scan_loop();
+                    }
+                }
+                letters[letter].release();
+                run_one_scan_loop();
+            }
+        }
+        idle_for(KEY_OVERRIDE_REPEAT_DELAY * 2);
+    }
+
+    std::vector<KeymapKey>      letters;
+    std::vector<KeymapKey>      mods;
+    std::vector<key_override_t> storage;
+};
+
+TEST_F(KeyOverride, shift_backspace_sends_delete) {
+    TestDriver driver;
+    auto       key_bspc = KeymapKey(0, 0, 3, KC_BACKSPACE);
+    add_key(key_bspc);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_DELETE)).Times(1);
+    EXPECT_REPORT(driver, (KC_LSFT, KC_BACKSPACE)).Times(0);
+    mods[1].press();
+    run_one_scan_loop();
+    tap_key(key_bspc);
+    mods[1].release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, first_defined_override_wins) {
+    TestDriver driver;
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_B)).Times(1);
+    EXPECT_REPORT(driver, (KC_C)).Times(0);
+    mods[0].press();
+    run_one_scan_loop();
+    tap_key(letters[0]);
+    mods[0].release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, mod_pressed_after_trigger_activates_after_repeat_delay) {
+    TestDriver driver;
+    auto      &key_x = letters[KC_X - KC_A];
+
+    EXPECT_REPORT(driver, (KC_X));
+    key_x.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_Y)).Times(0);
+    mods[2].press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_Y));
+    idle_for(KEY_OVERRIDE_REPEAT_DELAY);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    mods[2].release();
+    run_one_scan_loop();
+    key_x.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, index_activates_the_same_overrides_as_scanning_all) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    /* Fits in the index, so only overrides sharing the event's trigger are looked at. */
+    generate(key_override_index_size());
+    activations.clear();
+    type_everything();
+    std::vector<uintptr_t> indexed = activations;
+
+    /* One more override than fits, which can never activate, makes every event look at every override. */
+    generate(key_override_index_size(), 1);
+    activations.clear();
+    type_everything();
+
+    EXPECT_FALSE(indexed.empty());
+    EXPECT_EQ(indexed, activations);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, lookups_scale_with_the_trigger_not_the_override_count) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    auto gets_per_press = [&](uint16_t count, uint16_t never_matching) {
+        generate(count, never_matching);
+        override_gets = 0;
+        for (auto &letter : letters) {
+            tap_key(letter);
+        }
+        return (double)override_gets / letters.size();
+    };
+
+    for (uint16_t count : {(uint16_t)16, (uint16_t)32, (uint16_t)64, key_override_index_size()}) {
+        double indexed = gets_per_press(count, 0);
+        std::cout << count << " key overrides: " << indexed << " looked at per key press" << std::endl;
+
+        /* A binary search for the key's trigger and for KC_NO, then two lookups for each override sharing the key's trigger. */
+        EXPECT_LT(indexed, 2 * 9 + 2 * (count / 26 + 1));
+    }
+
+    /* Past the size of the index every key press looks at every override. */
+    double scanned = gets_per_press(key_override_index_size(), 1);
+    std::cout << key_override_index_size() + 1 << " key overrides, not indexed: " << scanned << " looked at per key press" << std::endl;
+    EXPECT_GT(scanned, key_override_index_size());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, index_is_sized_for_the_keymap) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    /* Without KEY_OVERRIDE_INDEX_SIZE, every override in the keymap is indexed, however many there are. */
+    EXPECT_GT(key_override_count_raw(), 100);
+    EXPECT_EQ(key_override_index_size(), key_override_count_raw());
+
+    override_gets = 0;
+    for (auto &letter : letters) {
+        tap_key(letter);
+    }
+    /* Binary searches of the index, rather than a scan of every override. */
+    EXPECT_LT((double)override_gets / letters.size(), key_override_count_raw() / 4);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,31 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+const key_override_t shift_backspace_override = ko_make_basic(MOD_MASK_SHIFT, KC_BACKSPACE, KC_DELETE);
+const key_override_t ctrl_a_override          = ko_make_basic(MOD_MASK_CTRL, KC_A, KC_B);
+const key_override_t ctrl_a_shadowed_override = ko_make_basic(MOD_MASK_CTRL, KC_A, KC_C);
+const key_override_t alt_x_override           = ko_make_basic(MOD_MASK_ALT, KC_X, KC_Y);
+
+// Enough key overrides on no layer to make the keymap's index larger than the generated sets the tests use
+const key_override_t padding_overrides[128] = {[0 ... 127] = ko_make_with_layers(MOD_MASK_CTRL, KC_F24, KC_NO, 0)};
+
+#define PAD_1(n) &padding_overrides[n],
+#define PAD_2(n) PAD_1(n) PAD_1(n + 1)
+#define PAD_4(n) PAD_2(n) PAD_2(n + 2)
+#define PAD_8(n) PAD_4(n) PAD_4(n + 4)
+#define PAD_16(n) PAD_8(n) PAD_8(n + 8)
+#define PAD_32(n) PAD_16(n) PAD_16(n + 16)
+#define PAD_64(n) PAD_32(n) PAD_32(n + 32)
+#define PAD_128(n) PAD_64(n) PAD_64(n + 64)
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &shift_backspace_override,
+    &ctrl_a_override,
+    &ctrl_a_shadowed_override,
+    &alt_x_override,
+    PAD_128(0)
+};
+// clang-format on
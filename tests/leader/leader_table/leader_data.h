@@ -0,0 +1,42 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Leader sequences (6 entries):
+//   KC_A                     -> KC_1
+//   KC_A KC_B                -> KC_2
+//   KC_A KC_B KC_C           -> KC_3
+//   KC_S KC_S                -> KC_PSCR
+//   KC_E KC_M                -> QK_USER_0
+//   KC_D KC_D KC_D KC_D KC_D -> KC_5
+
+#define LEADER_TABLE_SIZE 50
+
+static const uint16_t leader_table[LEADER_TABLE_SIZE] PROGMEM = {
+    4, KC_NO, KC_A, 10, KC_S, 20, KC_E, 26, KC_D, 32, 1, KC_1, KC_B, 14, 1, KC_2, KC_C, 18, 0, KC_3,
+    1, KC_NO, KC_S, 24, 0, KC_PSCR, 1, KC_NO, KC_M, 30, 0, QK_USER_0, 1, KC_NO, KC_D, 36, 1, KC_NO,
+    KC_D, 40, 1, KC_NO, KC_D, 44, 1, KC_NO, KC_D, 48, 0, KC_5
+};
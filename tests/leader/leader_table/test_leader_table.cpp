@@ -0,0 +1,161 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+/* leader_data.h in this folder was generated from:
+ *   KC_A                     -> KC_1
+ *   KC_A KC_B                -> KC_2
+ *   KC_A KC_B KC_C           -> KC_3
+ *   KC_S KC_S                -> KC_PSCR
+ *   KC_E KC_M                -> QK_USER_0
+ *   KC_D KC_D KC_D KC_D KC_D -> KC_5
+ */
+
+static std::vector<uint16_t> actions;
+static uint8_t               ended = 0;
+
+extern "C" bool leader_action_user(uint16_t action) {
+    actions.push_back(action);
+    return action != QK_USER_0;
+}
+
+extern "C" void leader_end_user(void) {
+    ended++;
+}
+
+class LeaderTable : public TestFixture {
+   public:
+    LeaderTable() {
+        set_keymap({key_leader, key_a, key_b, key_c, key_d, key_e, key_m, key_s});
+        actions.clear();
+        ended = 0;
+    }
+
+    KeymapKey key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    KeymapKey key_a      = KeymapKey(0, 1, 0, KC_A);
+    KeymapKey key_b      = KeymapKey(0, 2, 0, KC_B);
+    KeymapKey key_c      = KeymapKey(0, 3, 0, KC_C);
+    KeymapKey key_d      = KeymapKey(0, 4, 0, KC_D);
+    KeymapKey key_e      = KeymapKey(0, 5, 0, KC_E);
+    KeymapKey key_m      = KeymapKey(0, 6, 0, KC_M);
+    KeymapKey key_s      = KeymapKey(0, 7, 0, KC_S);
+};
+
+TEST_F(LeaderTable, prefix_waits_for_the_timeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    idle_for(LEADER_TIMEOUT - 10);
+    EXPECT_EQ(leader_sequence_active(), true);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(actions, std::vector<uint16_t>({KC_1}));
+    EXPECT_EQ(ended, 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTable, longer_prefix_waits_for_the_timeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_b);
+    EXPECT_EQ(leader_sequence_active(), true);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(LEADER_TIMEOUT);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTable, unambiguous_sequences_fire_immediately) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_c);
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(ended, 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_PRINT_SCREEN));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_s);
+    tap_key(key_s);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The keys after are typed as usual. */
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_c);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTable, longest_sequence_fires_on_its_last_key) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    for (uint8_t i = 0; i < 4; i++) {
+        tap_key(key_d);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_5));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_d);
+    EXPECT_EQ(leader_sequence_active(), false);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTable, user_handles_actions) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_e);
+    tap_key(key_m);
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(actions, std::vector<uint16_t>({QK_USER_0}));
+    EXPECT_EQ(ended, 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTable, unknown_sequence_taps_nothing) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_s);
+    tap_key(key_a);
+    tap_key(key_m);
+    idle_for(LEADER_TIMEOUT);
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_TRUE(actions.empty());
+    EXPECT_EQ(ended, 1);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,151 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+#include "../rgb_matrix_test_layout.h"
+
+using testing::_;
+
+extern "C" {
+#include "rgb_matrix.h"
+}
+
+/* An indicator drawn over LED 0 on every frame, when set. */
+static bool indicator_on = false;
+
+extern "C" bool rgb_matrix_indicators_user(void) {
+    if (indicator_on) {
+        rgb_matrix_set_color(0, 1, 2, 3);
+    }
+    return true;
+}
+
+class RgbMatrixFrameDiff : public TestFixture {
+   protected:
+    void SetUp() override {
+        indicator_on = false;
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+        rgb_matrix_set_speed_noeeprom(127);
+    }
+
+    /* Run a frame, checking the driver was asked to send everything that changed. */
+    void frame() {
+        test_rgb_matrix_task_frame();
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            ASSERT_EQ(test_led_flushed[i].r, test_led_buffer[i].r) << "LED " << +i;
+            ASSERT_EQ(test_led_flushed[i].g, test_led_buffer[i].g) << "LED " << +i;
+            ASSERT_EQ(test_led_flushed[i].b, test_led_buffer[i].b) << "LED " << +i;
+        }
+    }
+
+    void settle(uint8_t mode) {
+        test_rgb_matrix_select(mode);
+        for (unsigned i = 0; i < 4; i++) {
+            frame();
+        }
+    }
+};
+
+TEST_F(RgbMatrixFrameDiff, static_effect_skips_unchanged_frames) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle(RGB_MATRIX_SOLID_COLOR);
+
+    rgb_matrix_frame_stats_t before = *rgb_matrix_get_frame_stats();
+    for (unsigned i = 0; i < 100; i++) {
+        frame();
+    }
+    rgb_matrix_frame_stats_t after = *rgb_matrix_get_frame_stats();
+    EXPECT_EQ(after.skipped_frames, before.skipped_frames + 100);
+    EXPECT_EQ(after.flushed_frames, before.flushed_frames);
+
+    /* A change to the colour goes out again. */
+    rgb_matrix_sethsv_noeeprom(85, 255, 255);
+    frame();
+    EXPECT_EQ(rgb_matrix_get_frame_stats()->flushed_frames, after.flushed_frames + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixFrameDiff, reactive_effect_flushes_only_while_fading) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    settle(RGB_MATRIX_SOLID_REACTIVE);
+    VERIFY_AND_CLEAR(driver);
+
+    rgb_matrix_frame_stats_t before = *rgb_matrix_get_frame_stats();
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The hit fades out over a number of frames, after which the frame stops changing. */
+    EXPECT_NO_REPORT(driver);
+    for (unsigned i = 0; i < 100; i++) {
+        frame();
+    }
+    rgb_matrix_frame_stats_t after = *rgb_matrix_get_frame_stats();
+    EXPECT_GT(after.flushed_frames, before.flushed_frames);
+    EXPECT_GT(after.skipped_frames, before.skipped_frames);
+    EXPECT_EQ(after.flushed_frames + after.skipped_frames - before.flushed_frames - before.skipped_frames, 100);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixFrameDiff, animated_effect_flushes_every_frame) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    rgb_matrix_set_speed_noeeprom(255);
+    settle(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+
+    rgb_matrix_frame_stats_t before = *rgb_matrix_get_frame_stats();
+    for (unsigned i = 0; i < 100; i++) {
+        frame();
+    }
+    rgb_matrix_frame_stats_t after = *rgb_matrix_get_frame_stats();
+    EXPECT_EQ(after.flushed_frames, before.flushed_frames + 100);
+    EXPECT_EQ(after.skipped_frames, before.skipped_frames);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixFrameDiff, out_of_range_leds_are_ignored) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle(RGB_MATRIX_SOLID_COLOR);
+
+    /* None of these are LEDs, so nothing changed and the next frame is skipped. */
+    uint32_t skipped = rgb_matrix_get_frame_stats()->skipped_frames;
+    rgb_matrix_set_color(-1, 1, 2, 3);
+    rgb_matrix_set_color(RGB_MATRIX_LED_COUNT, 1, 2, 3);
+    rgb_matrix_set_color(NO_LED, 1, 2, 3);
+    frame();
+    EXPECT_EQ(rgb_matrix_get_frame_stats()->skipped_frames, skipped + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixFrameDiff, indicator_over_an_effect_is_flushed_once) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle(RGB_MATRIX_SOLID_COLOR);
+
+    /* The effect draws LED 0 every frame, and the indicator draws over it. */
+    indicator_on                    = true;
+    rgb_matrix_frame_stats_t before = *rgb_matrix_get_frame_stats();
+    for (unsigned i = 0; i < 100; i++) {
+        frame();
+    }
+    rgb_matrix_frame_stats_t after = *rgb_matrix_get_frame_stats();
+    EXPECT_EQ(after.flushed_frames, before.flushed_frames + 1);
+    EXPECT_EQ(after.skipped_frames, before.skipped_frames + 99);
+    EXPECT_EQ(test_led_flushed[0].r, 1);
+    EXPECT_EQ(test_led_flushed[0].g, 2);
+    EXPECT_EQ(test_led_flushed[0].b, 3);
+    VERIFY_AND_CLEAR(driver);
+}
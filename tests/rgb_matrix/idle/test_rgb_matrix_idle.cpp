@@ -0,0 +1,134 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+#include "../rgb_matrix_test_layout.h"
+
+using testing::_;
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "timer.h"
+}
+
+class RgbMatrixIdle : public TestFixture {
+   protected:
+    void SetUp() override {
+        uint32_t now = timer_read32();
+        set_activity_timestamps(now, now, now);
+        test_rgb_matrix_select(RGB_MATRIX_CYCLE_LEFT_RIGHT);
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    }
+
+    void TearDown() override {
+        rgb_matrix_set_suspend_state(false);
+        rgb_matrix_task();
+    }
+
+    bool all_leds_off() {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            if (test_led_buffer[i].r || test_led_buffer[i].g || test_led_buffer[i].b) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* Scan until the next flush reaches the driver, returning the number of scans it took. */
+    unsigned scan_until_flush() {
+        uint32_t flushed = test_rgb_matrix_flushes();
+        unsigned scans   = 0;
+        while (test_rgb_matrix_flushes() == flushed && scans < 1000) {
+            run_one_scan_loop();
+            scans++;
+        }
+        return scans;
+    }
+};
+
+TEST_F(RgbMatrixIdle, timeout_shuts_down_drivers_and_stops_flushing) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    /* Typing keeps the matrix awake and animating. */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_LT(scan_until_flush(), 1000u);
+    EXPECT_FALSE(all_leds_off());
+
+    uint32_t shutdowns = test_rgb_matrix_shutdowns();
+    idle_for(RGB_MATRIX_TIMEOUT + RGB_MATRIX_LED_FLUSH_LIMIT);
+    EXPECT_EQ(test_rgb_matrix_shutdowns(), shutdowns + 1);
+    EXPECT_TRUE(all_leds_off());
+
+    /* Nothing more reaches the drivers however long the keyboard is left alone. */
+    uint32_t flushes = test_rgb_matrix_flushes();
+    idle_for(RGB_MATRIX_TIMEOUT * 5);
+    EXPECT_EQ(test_rgb_matrix_flushes(), flushes);
+    EXPECT_EQ(test_rgb_matrix_shutdowns(), shutdowns + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixIdle, keypress_wakes_with_a_single_full_flush) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    idle_for(RGB_MATRIX_TIMEOUT + RGB_MATRIX_LED_FLUSH_LIMIT);
+    VERIFY_AND_CLEAR(driver);
+    ASSERT_TRUE(all_leds_off());
+
+    uint32_t exit_shutdowns = test_rgb_matrix_exit_shutdowns();
+    uint32_t flushes        = test_rgb_matrix_flushes();
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(test_rgb_matrix_exit_shutdowns(), exit_shutdowns + 1);
+
+    /* The first flush after waking carries a complete frame, no black frame goes out first. */
+    EXPECT_LT(scan_until_flush(), 1000u);
+    EXPECT_EQ(test_rgb_matrix_flushes(), flushes + 1);
+    EXPECT_FALSE(all_leds_off());
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(test_rgb_matrix_exit_shutdowns(), exit_shutdowns + 1);
+}
+
+TEST_F(RgbMatrixIdle, suspend_blanks_immediately_and_resumes) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    test_rgb_matrix_task_frame();
+    ASSERT_FALSE(all_leds_off());
+
+    uint32_t shutdowns = test_rgb_matrix_shutdowns();
+    uint32_t flushes   = test_rgb_matrix_flushes();
+    rgb_matrix_set_suspend_state(true);
+    EXPECT_EQ(test_rgb_matrix_shutdowns(), shutdowns + 1);
+    EXPECT_EQ(test_rgb_matrix_flushes(), flushes + 1);
+    EXPECT_TRUE(all_leds_off());
+
+    idle_for(RGB_MATRIX_TIMEOUT / 2);
+    EXPECT_EQ(test_rgb_matrix_flushes(), flushes + 1);
+    EXPECT_EQ(test_rgb_matrix_shutdowns(), shutdowns + 1);
+
+    uint32_t exit_shutdowns = test_rgb_matrix_exit_shutdowns();
+    rgb_matrix_set_suspend_state(false);
+    test_rgb_matrix_task_frame();
+    EXPECT_EQ(test_rgb_matrix_exit_shutdowns(), exit_shutdowns + 1);
+    EXPECT_EQ(test_rgb_matrix_flushes(), flushes + 2);
+    EXPECT_FALSE(all_leds_off());
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,12 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+SRC += tests/rgb_matrix/rgb_matrix_test_layout.c
+SRC += tests/rgb_matrix/test_rgb_matrix_render_report.cpp
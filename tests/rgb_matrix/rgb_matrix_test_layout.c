@@ -0,0 +1,283 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "rgb_matrix_test_layout.h"
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+void advance_time(uint32_t ms);
+
+typedef hsv_t (*reactive_splash_f)(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+typedef int16_t (*reactive_splash_reach_f)(uint16_t tick);
+
+bool    effect_runner_reactive_splash(uint8_t start, effect_params_t *params, reactive_splash_f effect_func);
+bool    effect_runner_reactive_splash_reach(uint8_t start, effect_params_t *params, reactive_splash_f effect_func, reactive_splash_reach_f reach_func);
+hsv_t   SOLID_SPLASH_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+int16_t SOLID_SPLASH_reach(uint16_t tick);
+hsv_t   SPLASH_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+bool    SOLID_REACTIVE_MULTIWIDE(effect_params_t *params);
+bool    SOLID_REACTIVE_MULTICROSS(effect_params_t *params);
+bool    SOLID_REACTIVE_NEXUS(effect_params_t *params);
+bool    SOLID_REACTIVE_MULTINEXUS(effect_params_t *params);
+bool    SOLID_MULTISPLASH(effect_params_t *params);
+bool    SPLASH(effect_params_t *params);
+bool    MULTISPLASH(effect_params_t *params);
+
+// clang-format off
+/* 120 LEDs on a 20x6 grid, the 4x10 key matrix sits on the odd columns of the four middle rows. */
+led_config_t g_led_config = {
+    {
+        {  21,  23,  25,  27,  29,  31,  33,  35,  37,  39 },
+        {  41,  43,  45,  47,  49,  51,  53,  55,  57,  59 },
+        {  61,  63,  65,  67,  69,  71,  73,  75,  77,  79 },
+        {  81,  83,  85,  87,  89,  91,  93,  95,  97,  99 },
+    }, {
+        {  0,  0}, { 11,  0}, { 23,  0}, { 35,  0}, { 47,  0}, { 58,  0}, { 70,  0}, { 82,  0}, { 94,  0}, {106,  0}, {117,  0}, {129,  0}, {141,  0}, {153,  0}, {165,  0}, {176,  0}, {188,  0}, {200,  0}, {212,  0}, {224,  0},
+        {  0, 12}, { 11, 12}, { 23, 12}, { 35, 12}, { 47, 12}, { 58, 12}, { 70, 12}, { 82, 12}, { 94, 12}, {106, 12}, {117, 12}, {129, 12}, {141, 12}, {153, 12}, {165, 12}, {176, 12}, {188, 12}, {200, 12}, {212, 12}, {224, 12},
+        {  0, 25}, { 11, 25}, { 23, 25}, { 35, 25}, { 47, 25}, { 58, 25}, { 70, 25}, { 82, 25}, { 94, 25}, {106, 25}, {117, 25}, {129, 25}, {141, 25}, {153, 25}, {165, 25}, {176, 25}, {188, 25}, {200, 25}, {212, 25}, {224, 25},
+        {  0, 38}, { 11, 38}, { 23, 38}, { 35, 38}, { 47, 38}, { 58, 38}, { 70, 38}, { 82, 38}, { 94, 38}, {106, 38}, {117, 38}, {129, 38}, {141, 38}, {153, 38}, {165, 38}, {176, 38}, {188, 38}, {200, 38}, {212, 38}, {224, 38},
+        {  0, 51}, { 11, 51}, { 23, 51}, { 35, 51}, { 47, 51}, { 58, 51}, { 70, 51}, { 82, 51}, { 94, 51}, {106, 51}, {117, 51}, {129, 51}, {141, 51}, {153, 51}, {165, 51}, {176, 51}, {188, 51}, {200, 51}, {212, 51}, {224, 51},
+        {  0, 64}, { 11, 64}, { 23, 64}, { 35, 64}, { 47, 64}, { 58, 64}, { 70, 64}, { 82, 64}, { 94, 64}, {106, 64}, {117, 64}, {129, 64}, {141, 64}, {153, 64}, {165, 64}, {176, 64}, {188, 64}, {200, 64}, {212, 64}, {224, 64},
+    }, {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4,
+        2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4,
+        2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4,
+        2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    }
+};
+// clang-format on
+
+test_led_t test_led_buffer[RGB_MATRIX_LED_COUNT];
+
+static void test_driver_init(void) {}
+
+static void test_driver_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
+        test_led_buffer[index] = (test_led_t){r, g, b};
+    }
+}
+
+static void test_driver_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        test_driver_set_color(i, r, g, b);
+    }
+}
+
+test_led_t test_led_flushed[RGB_MATRIX_LED_COUNT];
+
+static uint32_t flushes;
+static uint32_t shutdowns;
+static uint32_t exit_shutdowns;
+
+static void test_driver_flush(void) {
+    memcpy(test_led_flushed, test_led_buffer, sizeof(test_led_flushed));
+    flushes++;
+}
+
+static void test_driver_shutdown(void) {
+    shutdowns++;
+}
+
+static void test_driver_exit_shutdown(void) {
+    exit_shutdowns++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = test_driver_init,
+    .set_color     = test_driver_set_color,
+    .set_color_all = test_driver_set_color_all,
+    .flush         = test_driver_flush,
+    .shutdown      = test_driver_shutdown,
+    .exit_shutdown = test_driver_exit_shutdown,
+};
+
+uint32_t test_rgb_matrix_flushes(void) {
+    return flushes;
+}
+
+uint32_t test_rgb_matrix_shutdowns(void) {
+    return shutdowns;
+}
+
+uint32_t test_rgb_matrix_exit_shutdowns(void) {
+    return exit_shutdowns;
+}
+
+void test_rgb_matrix_set_hits(const uint8_t *leds, const uint16_t *ticks, uint8_t count) {
+    g_last_hit_tracker.count = count;
+    for (uint8_t i = 0; i < count; i++) {
+        g_last_hit_tracker.x[i]     = g_led_config.point[leds[i]].x;
+        g_last_hit_tracker.y[i]     = g_led_config.point[leds[i]].y;
+        g_last_hit_tracker.index[i] = leds[i];
+        g_last_hit_tracker.tick[i]  = ticks[i];
+    }
+}
+
+uint8_t test_rgb_matrix_hit_count(void) {
+    return g_last_hit_tracker.count;
+}
+
+uint8_t test_rgb_matrix_hit_led(uint8_t hit) {
+    return g_last_hit_tracker.index[hit];
+}
+
+uint16_t test_rgb_matrix_hit_tick(uint8_t hit) {
+    return g_last_hit_tracker.tick[hit];
+}
+
+uint8_t test_rgb_matrix_key_led(uint8_t row, uint8_t col) {
+    return g_led_config.matrix_co[row][col];
+}
+
+static const char *effect_names[] = {
+    "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+uint8_t test_rgb_matrix_effect_count(void) {
+    return RGB_MATRIX_EFFECT_MAX;
+}
+
+const char *test_rgb_matrix_effect_name(uint8_t mode) {
+    return effect_names[mode];
+}
+
+void test_rgb_matrix_select(uint8_t mode) {
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_mode_noeeprom(mode);
+}
+
+/* Frames the matrix has finished with, flushed or skipped as unchanged. */
+static uint32_t frames_done(void) {
+#ifdef RGB_MATRIX_FRAME_DIFF
+    return flushes + rgb_matrix_get_frame_stats()->skipped_frames;
+#else
+    return flushes;
+#endif
+}
+
+void test_rgb_matrix_task_frame(void) {
+    uint32_t done = frames_done();
+    advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+    while (frames_done() == done) {
+        rgb_matrix_task();
+    }
+}
+
+/* The reactive tests drive the runners directly, which are not linkable once inlined. */
+#ifndef RGB_MATRIX_INLINE_RUNNERS
+/* Copies of the effect maths before they were given a reach. */
+static hsv_t reference_wide_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
+    uint16_t effect = tick + dist * 5;
+    if (effect > 255) effect = 255;
+    hsv.v = qadd8(hsv.v, 255 - effect);
+    return hsv;
+}
+
+static hsv_t reference_cross_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
+    uint16_t effect = tick + dist;
+    dx              = dx < 0 ? dx * -1 : dx;
+    dy              = dy < 0 ? dy * -1 : dy;
+    dx              = dx * 16 > 255 ? 255 : dx * 16;
+    dy              = dy * 16 > 255 ? 255 : dy * 16;
+    effect += dx > dy ? dy : dx;
+    if (effect > 255) effect = 255;
+    hsv.v = qadd8(hsv.v, 255 - effect);
+    return hsv;
+}
+
+static hsv_t reference_nexus_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
+    uint16_t effect = tick - dist;
+    if (effect > 255) effect = 255;
+    if (dist > 72) effect = 255;
+    if ((dx > 8 || dx < -8) && (dy > 8 || dy < -8)) effect = 255;
+    hsv.h = rgb_matrix_config.hsv.h + dy / 4;
+    hsv.v = qadd8(hsv.v, 255 - effect);
+    return hsv;
+}
+
+static uint32_t splash_evaluations;
+
+static hsv_t counting_splash_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick) {
+    splash_evaluations++;
+    return SOLID_SPLASH_math(hsv, dx, dy, dist, tick);
+}
+
+void test_rgb_matrix_render(test_effect_t effect) {
+    effect_params_t params = {0, LED_FLAG_ALL, false};
+    bool            rendering;
+    do {
+        switch (effect) {
+            case TEST_EFFECT_MULTIWIDE:
+                rendering = SOLID_REACTIVE_MULTIWIDE(&params);
+                break;
+            case TEST_EFFECT_MULTICROSS:
+                rendering = SOLID_REACTIVE_MULTICROSS(&params);
+                break;
+            case TEST_EFFECT_SPLASH:
+                rendering = SPLASH(&params);
+                break;
+            case TEST_EFFECT_MULTISPLASH:
+                rendering = MULTISPLASH(&params);
+                break;
+            case TEST_EFFECT_NEXUS:
+                rendering = SOLID_REACTIVE_NEXUS(&params);
+                break;
+            case TEST_EFFECT_MULTINEXUS:
+                rendering = SOLID_REACTIVE_MULTINEXUS(&params);
+                break;
+            default:
+                rendering = SOLID_MULTISPLASH(&params);
+                break;
+        }
+        params.iter++;
+    } while (rendering);
+}
+
+void test_rgb_matrix_render_reference(test_effect_t effect) {
+    effect_params_t params = {0, LED_FLAG_ALL, false};
+    bool            rendering;
+    do {
+        switch (effect) {
+            case TEST_EFFECT_MULTIWIDE:
+                rendering = effect_runner_reactive_splash(0, &params, &reference_wide_math);
+                break;
+            case TEST_EFFECT_MULTICROSS:
+                rendering = effect_runner_reactive_splash(0, &params, &reference_cross_math);
+                break;
+            case TEST_EFFECT_SPLASH:
+                rendering = effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), &params, &SPLASH_math);
+                break;
+            case TEST_EFFECT_MULTISPLASH:
+                rendering = effect_runner_reactive_splash(0, &params, &SPLASH_math);
+                break;
+            case TEST_EFFECT_NEXUS:
+                rendering = effect_runner_reactive_splash(qsub8(g_last_hit_tracker.count, 1), &params, &reference_nexus_math);
+                break;
+            case TEST_EFFECT_MULTINEXUS:
+                rendering = effect_runner_reactive_splash(0, &params, &reference_nexus_math);
+                break;
+            default:
+                rendering = effect_runner_reactive_splash(0, &params, &SOLID_SPLASH_math);
+                break;
+        }
+        params.iter++;
+    } while (rendering);
+}
+
+uint32_t test_rgb_matrix_splash_evaluations(bool cull) {
+    effect_params_t params = {0, LED_FLAG_ALL, false};
+    bool            rendering;
+    splash_evaluations = 0;
+    do {
+        rendering = effect_runner_reactive_splash_reach(0, &params, &counting_splash_math, cull ? &SOLID_SPLASH_reach : NULL);
+        params.iter++;
+    } while (rendering);
+    return splash_evaluations;
+}
+#endif // RGB_MATRIX_INLINE_RUNNERS
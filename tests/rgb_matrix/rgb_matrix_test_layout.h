@@ -0,0 +1,61 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} test_led_t;
+
+typedef enum {
+    TEST_EFFECT_MULTIWIDE,
+    TEST_EFFECT_MULTICROSS,
+    TEST_EFFECT_SOLID_MULTISPLASH,
+    TEST_EFFECT_SPLASH,
+    TEST_EFFECT_MULTISPLASH,
+    TEST_EFFECT_NEXUS,
+    TEST_EFFECT_MULTINEXUS,
+} test_effect_t;
+
+/* Colours written by rgb_matrix through the test driver. */
+extern test_led_t test_led_buffer[];
+
+/* Colours the test driver has been asked to send to the LEDs. */
+extern test_led_t test_led_flushed[];
+
+/* Number of calls rgb_matrix has made into each test driver hook. */
+uint32_t test_rgb_matrix_flushes(void);
+uint32_t test_rgb_matrix_shutdowns(void);
+uint32_t test_rgb_matrix_exit_shutdowns(void);
+
+void     test_rgb_matrix_set_hits(const uint8_t *leds, const uint16_t *ticks, uint8_t count);
+uint8_t  test_rgb_matrix_hit_count(void);
+uint8_t  test_rgb_matrix_hit_led(uint8_t hit);
+uint16_t test_rgb_matrix_hit_tick(uint8_t hit);
+uint8_t  test_rgb_matrix_key_led(uint8_t row, uint8_t col);
+
+uint8_t     test_rgb_matrix_effect_count(void);
+const char *test_rgb_matrix_effect_name(uint8_t mode);
+void        test_rgb_matrix_select(uint8_t mode);
+/* Run rgb_matrix_task until the next frame has been flushed to the driver, or skipped as unchanged. */
+void test_rgb_matrix_task_frame(void);
+
+/* Render one full frame of the effect as shipped. */
+void test_rgb_matrix_render(test_effect_t effect);
+/* Render one full frame with the unculled runner, evaluating every hit for every LED. */
+void test_rgb_matrix_render_reference(test_effect_t effect);
+/* Render one full frame of SOLID_MULTISPLASH and return how many times its maths ran. */
+uint32_t test_rgb_matrix_splash_evaluations(bool cull);
+
+#ifdef __cplusplus
+}
+#endif
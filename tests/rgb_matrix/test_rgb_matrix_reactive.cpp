@@ -0,0 +1,133 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+#include "rgb_matrix_test_layout.h"
+
+extern "C" {
+void rgb_matrix_set_speed_noeeprom(uint8_t speed);
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+class RgbMatrixReactive : public TestFixture {};
+
+static void expect_frames_match(test_effect_t effect) {
+    test_led_t reference[RGB_MATRIX_LED_COUNT];
+    test_rgb_matrix_render_reference(effect);
+    std::copy(test_led_buffer, test_led_buffer + RGB_MATRIX_LED_COUNT, reference);
+    test_rgb_matrix_render(effect);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        EXPECT_EQ(test_led_buffer[i].r, reference[i].r) << "led " << +i;
+        EXPECT_EQ(test_led_buffer[i].g, reference[i].g) << "led " << +i;
+        EXPECT_EQ(test_led_buffer[i].b, reference[i].b) << "led " << +i;
+    }
+}
+
+/* A burst of typing at roughly 150 WPM, one hit every 80ms, on keys spread around the board. */
+static const uint8_t fast_typing_leds[] = {21, 99, 45, 73, 31, 57, 87, 63};
+
+static void set_fast_typing_hits(uint16_t age) {
+    uint16_t ticks[sizeof(fast_typing_leds)];
+    for (uint8_t i = 0; i < sizeof(fast_typing_leds); i++) {
+        ticks[i] = age + (sizeof(fast_typing_leds) - 1 - i) * 80;
+    }
+    test_rgb_matrix_set_hits(fast_typing_leds, ticks, sizeof(fast_typing_leds));
+}
+
+TEST_F(RgbMatrixReactive, hit_tracker_keeps_most_recent_hits_in_order) {
+    TestDriver             driver;
+    std::vector<KeymapKey> keys;
+
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        keys.push_back(KeymapKey(0, col, 1, KC_A + col));
+        keys.push_back(KeymapKey(0, col, 2, KC_A + MATRIX_COLS + col));
+    }
+    for (auto& key : keys) {
+        add_key(key);
+    }
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    for (auto& key : keys) {
+        tap_key(key);
+    }
+    idle_for(RGB_MATRIX_LED_FLUSH_LIMIT * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_EQ(test_rgb_matrix_hit_count(), LED_HITS_TO_REMEMBER);
+    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; i++) {
+        auto& key = keys[keys.size() - LED_HITS_TO_REMEMBER + i];
+        EXPECT_EQ(test_rgb_matrix_hit_led(i), test_rgb_matrix_key_led(key.position.row, key.position.col)) << "hit " << +i;
+        if (i > 0) {
+            EXPECT_LT(test_rgb_matrix_hit_tick(i), test_rgb_matrix_hit_tick(i - 1)) << "hit " << +i;
+        }
+    }
+}
+
+TEST_F(RgbMatrixReactive, hit_tracker_expires_oldest_hits_first) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 1, KC_A);
+    auto       key_b = KeymapKey(0, 9, 2, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(key_a);
+    idle_for(UINT16_MAX - 1000);
+    tap_key(key_b);
+    idle_for(2000);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_EQ(test_rgb_matrix_hit_count(), 1);
+    EXPECT_EQ(test_rgb_matrix_hit_led(0), test_rgb_matrix_key_led(2, 9));
+}
+
+TEST_F(RgbMatrixReactive, culled_effects_match_unculled_runner) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    for (uint8_t speed : {0, 127, 255}) {
+        rgb_matrix_set_speed_noeeprom(speed);
+        for (uint16_t age = 0; age < 1200; age += 16) {
+            set_fast_typing_hits(age);
+            expect_frames_match(TEST_EFFECT_MULTIWIDE);
+            expect_frames_match(TEST_EFFECT_MULTICROSS);
+            expect_frames_match(TEST_EFFECT_SOLID_MULTISPLASH);
+            expect_frames_match(TEST_EFFECT_SPLASH);
+            expect_frames_match(TEST_EFFECT_MULTISPLASH);
+            expect_frames_match(TEST_EFFECT_NEXUS);
+            expect_frames_match(TEST_EFFECT_MULTINEXUS);
+        }
+    }
+    rgb_matrix_set_speed_noeeprom(RGB_MATRIX_DEFAULT_SPD);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RgbMatrixReactive, fast_typing_benchmark_120_leds) {
+    TestDriver driver;
+    uint64_t   evaluations[2] = {0, 0};
+    double     elapsed_us[2]  = {0, 0};
+
+    EXPECT_NO_REPORT(driver);
+    for (bool cull : {false, true}) {
+        auto start = std::chrono::steady_clock::now();
+        /* Two seconds worth of frames while the burst fades out. */
+        for (uint16_t age = 0; age < 2000; age += RGB_MATRIX_LED_FLUSH_LIMIT) {
+            set_fast_typing_hits(age);
+            evaluations[cull] += test_rgb_matrix_splash_evaluations(cull);
+        }
+        elapsed_us[cull] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    std::cout << "SOLID_MULTISPLASH on " << RGB_MATRIX_LED_COUNT << " LEDs with " << sizeof(fast_typing_leds) << " hits:" << std::endl;
+    std::cout << "  unculled: " << evaluations[0] << " evaluations, " << elapsed_us[0] << "us" << std::endl;
+    std::cout << "  culled:   " << evaluations[1] << " evaluations, " << elapsed_us[1] << "us" << std::endl;
+
+    EXPECT_LT(evaluations[1] * 2, evaluations[0]);
+}
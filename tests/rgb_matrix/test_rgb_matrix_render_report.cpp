@@ -0,0 +1,40 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iomanip>
+#include "test_common.hpp"
+#include "rgb_matrix_test_layout.h"
+
+using testing::_;
+
+class RgbMatrixRenderReport : public TestFixture {};
+
+/* Not a pass/fail benchmark, prints how long each enabled effect takes to render a frame on the
+ * host so builds with and without RGB_MATRIX_INLINE_RUNNERS can be compared. */
+TEST_F(RgbMatrixRenderReport, frame_time_per_effect) {
+    TestDriver     driver;
+    const unsigned frames = 500;
+
+    EXPECT_NO_REPORT(driver);
+    std::cout << "Frame time on " << RGB_MATRIX_LED_COUNT << " LEDs";
+#ifdef RGB_MATRIX_INLINE_RUNNERS
+    std::cout << " with RGB_MATRIX_INLINE_RUNNERS";
+#endif
+    std::cout << ":" << std::endl;
+
+    for (uint8_t mode = 1; mode < test_rgb_matrix_effect_count(); mode++) {
+        test_rgb_matrix_select(mode);
+        test_rgb_matrix_task_frame();
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned frame = 0; frame < frames; frame++) {
+            test_rgb_matrix_task_frame();
+        }
+        double elapsed_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "  " << std::left << std::setw(28) << test_rgb_matrix_effect_name(mode) << std::fixed << std::setprecision(2) << elapsed_us / frames << "us" << std::endl;
+    }
+    test_rgb_matrix_select(1);
+    VERIFY_AND_CLEAR(driver);
+}
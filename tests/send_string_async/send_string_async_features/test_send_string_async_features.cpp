@@ -0,0 +1,98 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+#include "../../send_string_coalesce/report_capture.hpp"
+
+extern "C" {
+#include "send_string.h"
+#include "unicode.h"
+}
+
+using testing::_;
+using testing::Invoke;
+
+/* Strings queued by features that also send keys of their own, or by the keyboard resetting. */
+class SendStringAsyncFeatures : public TestFixture {
+   public:
+    SendStringAsyncFeatures() {
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            CapturedReport captured = {report.mods, {}};
+            for (uint8_t key : report.keys) {
+                if (key != KC_NO) {
+                    captured.keys.push_back(key);
+                }
+            }
+            reports.push_back(captured);
+        }));
+        set_keymap({key_t, key_h, key_e, key_space, key_f, key_a, key_l, key_s});
+        autocorrect_enable();
+    }
+
+    /* The host's text, once backspaces are applied. */
+    std::string edited_text() {
+        std::string text;
+        for (char c : host_text(reports)) {
+            if (c == '\b') {
+                if (!text.empty()) {
+                    text.pop_back();
+                }
+            } else {
+                text += c;
+            }
+        }
+        return text;
+    }
+
+    TestDriver                  driver;
+    KeymapKey                   key_t     = KeymapKey(0, 0, 0, KC_T);
+    KeymapKey                   key_h     = KeymapKey(0, 1, 0, KC_H);
+    KeymapKey                   key_e     = KeymapKey(0, 2, 0, KC_E);
+    KeymapKey                   key_space = KeymapKey(0, 3, 0, KC_SPACE);
+    KeymapKey                   key_f     = KeymapKey(0, 4, 0, KC_F);
+    KeymapKey                   key_a     = KeymapKey(0, 5, 0, KC_A);
+    KeymapKey                   key_l     = KeymapKey(0, 6, 0, KC_L);
+    KeymapKey                   key_s     = KeymapKey(0, 7, 0, KC_S);
+    std::vector<CapturedReport> reports;
+};
+
+TEST_F(SendStringAsyncFeatures, autocorrection_comes_before_the_next_key) {
+    /* "fales" is corrected as the S is pressed, and the space follows straight away. */
+    tap_keys(key_f, key_a, key_l, key_e);
+    key_s.press();
+    run_one_scan_loop();
+    key_space.press();
+    run_one_scan_loop();
+    key_s.release();
+    key_space.release();
+    run_one_scan_loop();
+    EXPECT_TRUE(send_string_queue_empty());
+    EXPECT_EQ(edited_text(), "false ");
+}
+
+TEST_F(SendStringAsyncFeatures, autocorrection_comes_before_the_key_that_triggered_it) {
+    /* ":the:the:" is corrected when the space after it is pressed, which then goes out as well. */
+    tap_keys(key_t, key_h, key_e, key_space, key_t, key_h, key_e, key_space, key_t);
+    EXPECT_TRUE(send_string_queue_empty());
+    EXPECT_EQ(edited_text(), "the t");
+}
+
+TEST_F(SendStringAsyncFeatures, reset_types_out_the_queue) {
+    send_string("qmk\n");
+    reset_keyboard();
+    EXPECT_TRUE(send_string_queue_empty());
+    EXPECT_EQ(host_text(reports), "qmk\n");
+}
+
+TEST_F(SendStringAsyncFeatures, unicode_digits_go_out_inside_the_input_sequence) {
+    send_string("a");
+    register_unicode(0x00E4);
+    EXPECT_TRUE(send_string_queue_empty());
+    /* Ctrl+Shift+U, the hex digits, then space to end the sequence. */
+    EXPECT_EQ(host_text(reports), "aU00e4 ");
+}
@@ -0,0 +1,66 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "../../send_string_coalesce/report_capture.hpp"
+
+extern "C" {
+#include "send_string.h"
+#include "unicode.h"
+}
+
+using testing::_;
+using testing::Invoke;
+
+/* Strings and code points are typed out from separate queues. */
+class SendStringAsyncUnicodeAsync : public TestFixture {
+   public:
+    SendStringAsyncUnicodeAsync() {
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            CapturedReport captured = {report.mods, {}};
+            for (uint8_t key : report.keys) {
+                if (key != KC_NO) {
+                    captured.keys.push_back(key);
+                }
+            }
+            reports.push_back(captured);
+        }));
+    }
+
+    void run_until_typed() {
+        while (!send_string_queue_empty() || !unicode_queue_empty()) {
+            run_one_scan_loop();
+        }
+    }
+
+    TestDriver                  driver;
+    std::vector<CapturedReport> reports;
+};
+
+TEST_F(SendStringAsyncUnicodeAsync, string_goes_out_before_the_code_point_after_it) {
+    send_string("hi ");
+    send_unicode_string("ä");
+    run_until_typed();
+    /* Ctrl+Shift+U, the hex digits, then space to end the sequence. */
+    EXPECT_EQ(host_text(reports), "hi U00e4 ");
+}
+
+TEST_F(SendStringAsyncUnicodeAsync, code_point_goes_out_before_the_string_after_it) {
+    send_unicode_string("ä");
+    send_string("ok");
+    run_until_typed();
+    EXPECT_EQ(host_text(reports), "U00e4 ok");
+}
+
+TEST_F(SendStringAsyncUnicodeAsync, alternating_strings_and_code_points_stay_in_order) {
+    send_string("a");
+    register_unicode(0x00E4);
+    send_string("b");
+    register_unicode(0x00F6);
+    send_string("c");
+    run_until_typed();
+    EXPECT_EQ(host_text(reports), "aU00e4 bU00f6 c");
+}
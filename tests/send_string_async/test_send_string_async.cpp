@@ -0,0 +1,188 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "send_string.h"
+}
+
+using testing::_;
+using testing::Invoke;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == QK_USER_0 && record->event.pressed) {
+        send_string("aaaa");
+    }
+    return true;
+}
+
+struct Report {
+    uint32_t             time;
+    uint8_t              mods;
+    std::vector<uint8_t> keys;
+};
+
+/* Reports as "mods:keys", in hex, for comparing against what the host should see. */
+static std::vector<std::string> describe(const std::vector<Report> &reports) {
+    std::vector<std::string> described;
+    for (auto &report : reports) {
+        char entry[8];
+        snprintf(entry, sizeof(entry), "%02X:", report.mods);
+        std::string line = entry;
+        for (uint8_t key : report.keys) {
+            snprintf(entry, sizeof(entry), "%02X", key);
+            line += entry;
+        }
+        described.push_back(line);
+    }
+    return described;
+}
+
+class SendStringAsync : public TestFixture {
+   public:
+    SendStringAsync() {
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            Report captured = {timer_read32(), report.mods, {}};
+            for (uint8_t key : report.keys) {
+                if (key != KC_NO) {
+                    captured.keys.push_back(key);
+                }
+            }
+            reports.push_back(captured);
+        }));
+        set_keymap({key_j, key_macro});
+    }
+
+    /* Runs the main loop until the queue is empty. */
+    void drain(void) {
+        for (uint16_t i = 0; i < 1000 && !send_string_queue_empty(); i++) {
+            run_one_scan_loop();
+        }
+        EXPECT_TRUE(send_string_queue_empty());
+    }
+
+    TestDriver          driver;
+    KeymapKey           key_j     = KeymapKey(0, 0, 0, KC_J);
+    KeymapKey           key_macro = KeymapKey(0, 1, 0, QK_USER_0);
+    std::vector<Report> reports;
+};
+
+TEST_F(SendStringAsync, returns_without_sending_anything) {
+    uint32_t start = timer_read32();
+    send_string("Hi!");
+    EXPECT_EQ(timer_read32(), start);
+    EXPECT_TRUE(reports.empty());
+    EXPECT_FALSE(send_string_queue_empty());
+
+    drain();
+    /* Shift goes out with the key it is for, rather than in a report of its own. */
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"02:0B", "00:", "00:0C", "00:", "02:1E", "00:"}));
+}
+
+TEST_F(SendStringAsync, sends_one_report_per_interval) {
+    send_string("abc");
+    drain();
+    ASSERT_EQ(reports.size(), 6);
+    for (size_t i = 1; i < reports.size(); i++) {
+        EXPECT_EQ(reports[i].time - reports[i - 1].time, SEND_STRING_QUEUE_INTERVAL);
+    }
+
+    reports.clear();
+    send_string_with_delay("ab", 10);
+    drain();
+    ASSERT_EQ(reports.size(), 4);
+    for (size_t i = 1; i < reports.size(); i++) {
+        EXPECT_EQ(reports[i].time - reports[i - 1].time, 10);
+    }
+}
+
+TEST_F(SendStringAsync, follows_keycode_injection_and_delays) {
+    SEND_STRING(SS_LCTL("c") SS_DELAY(300) SS_TAP(X_ENTER));
+    drain();
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"01:", "01:06", "01:", "00:", "00:28", "00:"}));
+    EXPECT_GE(reports[4].time - reports[3].time, 300);
+    EXPECT_LT(reports[4].time - reports[3].time, 310);
+}
+
+TEST_F(SendStringAsync, keeps_scanning_the_matrix_while_typing) {
+    send_string("aaaa");
+    run_one_scan_loop();
+    run_one_scan_loop();
+    uint32_t start = timer_read32();
+    key_j.press();
+    run_one_scan_loop();
+    key_j.release();
+    run_one_scan_loop();
+
+    /* Neither scan waited for the string to be typed out. */
+    EXPECT_EQ(timer_read32() - start, 2);
+    EXPECT_FALSE(send_string_queue_empty());
+    drain();
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"00:04", "00:", "00:04", "00:", "00:04", "00:", "00:04", "00:", "00:0D", "00:"}));
+}
+
+TEST_F(SendStringAsync, keys_pressed_while_typing_come_after_the_string) {
+    send_string("aaaa");
+    run_one_scan_loop();
+    /* More key events than can be held back, so the last ones wait for the string. */
+    for (int i = 0; i < SEND_STRING_DEFERRED_EVENTS; i++) {
+        key_j.press();
+        run_one_scan_loop();
+        key_j.release();
+        run_one_scan_loop();
+    }
+    drain();
+
+    std::vector<std::string> expected = {"00:04", "00:", "00:04", "00:", "00:04", "00:", "00:04", "00:"};
+    for (int i = 0; i < SEND_STRING_DEFERRED_EVENTS; i++) {
+        expected.insert(expected.end(), {"00:0D", "00:"});
+    }
+    EXPECT_EQ(describe(reports), expected);
+}
+
+TEST_F(SendStringAsync, macro_key_release_does_not_wait_for_its_string) {
+    uint32_t start = timer_read32();
+    tap_key(key_macro);
+    tap_key(key_j);
+
+    /* One scan for each press and release. */
+    EXPECT_EQ(timer_read32() - start, 4);
+    EXPECT_FALSE(send_string_queue_empty());
+    drain();
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"00:04", "00:", "00:04", "00:", "00:04", "00:", "00:04", "00:", "00:0D", "00:"}));
+}
+
+TEST_F(SendStringAsync, blocks_only_when_the_queue_is_full) {
+    std::string text = "the quick brown fox jumps over the lazy dog";
+    uint32_t    start = timer_read32();
+    send_string(text.c_str());
+    /* What did not fit was typed out to make room, and the rest is left for the main loop. */
+    EXPECT_GT(timer_read32(), start);
+    EXPECT_FALSE(send_string_queue_empty());
+    size_t sent = reports.size();
+    EXPECT_LT(sent, text.size() * 2);
+
+    drain();
+    ASSERT_EQ(reports.size(), text.size() * 2);
+    for (size_t i = 0; i < text.size(); i++) {
+        uint8_t keycode = text[i] == ' ' ? KC_SPACE : KC_A + text[i] - 'a';
+        EXPECT_EQ(reports[i * 2].keys, std::vector<uint8_t>({keycode}));
+        EXPECT_TRUE(reports[i * 2 + 1].keys.empty());
+    }
+}
+
+TEST_F(SendStringAsync, flush_types_everything_out) {
+    send_string("ok");
+    send_char('\n');
+    send_string_queue_flush();
+    EXPECT_TRUE(send_string_queue_empty());
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"00:12", "00:", "00:0E", "00:", "00:28", "00:"}));
+}
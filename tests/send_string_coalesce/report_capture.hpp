@@ -0,0 +1,58 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "send_string.h"
+}
+
+struct CapturedReport {
+    uint8_t              mods;
+    std::vector<uint8_t> keys;
+};
+
+/* Reports as "mods:keys", in hex. */
+inline std::vector<std::string> describe(const std::vector<CapturedReport> &reports) {
+    std::vector<std::string> described;
+    for (auto &report : reports) {
+        char entry[8];
+        snprintf(entry, sizeof(entry), "%02X:", report.mods);
+        std::string line = entry;
+        for (uint8_t key : report.keys) {
+            snprintf(entry, sizeof(entry), "%02X", key);
+            line += entry;
+        }
+        described.push_back(line);
+    }
+    return described;
+}
+
+/* What a host makes of the reports: modifier changes are applied first, then releases, then
+ * presses, each press typing the character the send_string tables give for it. */
+inline std::string host_text(const std::vector<CapturedReport> &reports) {
+    std::string          text;
+    std::vector<uint8_t> held;
+    for (auto &report : reports) {
+        bool shifted = report.mods & MOD_BIT(KC_LEFT_SHIFT);
+        for (uint8_t key : report.keys) {
+            if (std::find(held.begin(), held.end(), key) != held.end()) {
+                continue;
+            }
+            for (uint8_t ascii = 0; ascii < 128; ascii++) {
+                bool ascii_shifted = (pgm_read_byte(&ascii_to_shift_lut[ascii / 8]) >> (ascii % 8)) & 1;
+                if (pgm_read_byte(&ascii_to_keycode_lut[ascii]) == key && ascii_shifted == shifted) {
+                    text += (char)ascii;
+                    break;
+                }
+            }
+        }
+        held = report.keys;
+    }
+    return text;
+}
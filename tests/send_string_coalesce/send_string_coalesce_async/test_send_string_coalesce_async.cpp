@@ -0,0 +1,65 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "../report_capture.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+class SendStringCoalesceAsync : public TestFixture {
+   public:
+    SendStringCoalesceAsync() {
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            CapturedReport captured = {report.mods, {}};
+            for (uint8_t key : report.keys) {
+                if (key != KC_NO) {
+                    captured.keys.push_back(key);
+                }
+            }
+            reports.push_back(captured);
+        }));
+    }
+
+    /* Runs the main loop until the queue is empty, returning how long that took. */
+    uint32_t drain(void) {
+        uint32_t start = timer_read32();
+        for (uint16_t i = 0; i < 1000 && !send_string_queue_empty(); i++) {
+            run_one_scan_loop();
+        }
+        EXPECT_TRUE(send_string_queue_empty());
+        return timer_read32() - start;
+    }
+
+    TestDriver                  driver;
+    std::vector<CapturedReport> reports;
+};
+
+TEST_F(SendStringCoalesceAsync, sends_the_same_reports_as_when_blocking) {
+    send_string("hello");
+    drain();
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"00:0B", "00:08", "00:0F", "00:", "00:0F", "00:12", "00:"}));
+    reports.clear();
+
+    send_string("Hi!");
+    drain();
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"02:0B", "00:0C", "02:1E", "00:"}));
+    reports.clear();
+
+    SEND_STRING("ab" SS_TAP(X_ENTER) "c" SS_LCTL("v") SS_DELAY(10) "d");
+    drain();
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"00:04", "00:05", "00:28", "00:06", "00:", "01:", "01:19", "01:", "00:", "00:07", "00:"}));
+}
+
+TEST_F(SendStringCoalesceAsync, types_the_same_text_sooner) {
+    const char *text = "The quick brown fox jumps over the lazy dog, 1234567890 times! (Really?)";
+    send_string(text);
+    uint32_t elapsed = drain();
+    EXPECT_EQ(host_text(reports), text);
+    std::cout << strlen(text) << " characters in " << reports.size() << " reports, " << elapsed << "ms" << std::endl;
+    EXPECT_LE(elapsed, reports.size() * SEND_STRING_QUEUE_INTERVAL + 1);
+    EXPECT_LT(reports.size(), strlen(text) * 5 / 4);
+}
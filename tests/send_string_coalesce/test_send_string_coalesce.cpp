@@ -0,0 +1,67 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "report_capture.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+class SendStringCoalesce : public TestFixture {
+   public:
+    SendStringCoalesce() {
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            CapturedReport captured = {report.mods, {}};
+            for (uint8_t key : report.keys) {
+                if (key != KC_NO) {
+                    captured.keys.push_back(key);
+                }
+            }
+            reports.push_back(captured);
+        }));
+    }
+
+    TestDriver                  driver;
+    std::vector<CapturedReport> reports;
+};
+
+TEST_F(SendStringCoalesce, rolls_each_key_over_into_the_next) {
+    send_string("hello");
+    /* The second l has to be released before it can be typed again. */
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"00:0B", "00:08", "00:0F", "00:", "00:0F", "00:12", "00:"}));
+    EXPECT_EQ(host_text(reports), "hello");
+}
+
+TEST_F(SendStringCoalesce, changes_modifiers_with_the_key) {
+    send_string("Hi!");
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"02:0B", "00:0C", "02:1E", "00:"}));
+    EXPECT_EQ(host_text(reports), "Hi!");
+}
+
+TEST_F(SendStringCoalesce, rolls_injected_taps_but_not_held_keys) {
+    SEND_STRING("ab" SS_TAP(X_ENTER) "c" SS_LCTL("v") SS_DELAY(10) "d");
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"00:04", "00:05", "00:28", "00:06", "00:", "01:", "01:19", "01:", "00:", "00:07", "00:"}));
+}
+
+TEST_F(SendStringCoalesce, leaves_nothing_held_after_the_string) {
+    send_string("ok");
+    EXPECT_TRUE(reports.back().keys.empty());
+    EXPECT_EQ(reports.back().mods, 0);
+    reports.clear();
+
+    /* A character on its own is typed out as before. */
+    send_char('A');
+    EXPECT_EQ(describe(reports), std::vector<std::string>({"02:", "02:04", "02:", "00:"}));
+}
+
+TEST_F(SendStringCoalesce, types_the_same_text_in_fewer_reports) {
+    const char *text = "The quick brown fox jumps over the lazy dog, 1234567890 times! (Really?)";
+    send_string(text);
+    EXPECT_EQ(host_text(reports), text);
+    size_t coalesced = reports.size();
+    std::cout << strlen(text) << " characters in " << coalesced << " reports" << std::endl;
+    EXPECT_LT(coalesced, strlen(text) * 5 / 4);
+}
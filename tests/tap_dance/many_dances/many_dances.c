@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "many_dances.h"
+
+tap_dance_action_t tap_dance_actions[] = {
+    [0 ... MANY_DANCES - 1] = ACTION_TAP_DANCE_FN_ADVANCED(many_dances_on_each_tap, many_dances_finished, many_dances_reset),
+};
@@ -0,0 +1,20 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* As many tap dances as there are tap dance keycodes. */
+#define MANY_DANCES (QK_TAP_DANCE_MAX - QK_TAP_DANCE)
+
+/* Defined by the tests, to log what each dance does. */
+void many_dances_on_each_tap(tap_dance_state_t *state, void *user_data);
+void many_dances_finished(tap_dance_state_t *state, void *user_data);
+void many_dances_reset(tap_dance_state_t *state, void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,190 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "keymap_introspection.h"
+#include "many_dances.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+static std::vector<std::string> dance_log;
+static uint32_t                 dance_lookups = 0;
+
+static void log_dance(const char *what, tap_dance_state_t *state) {
+    dance_log.push_back(std::string(what) + " " + std::to_string(TAP_DANCE_KEYCODE(state) - QK_TAP_DANCE) + " x" + std::to_string(state->count));
+}
+
+extern "C" void many_dances_on_each_tap(tap_dance_state_t *state, void *user_data) {
+    log_dance("tap", state);
+}
+
+extern "C" void many_dances_finished(tap_dance_state_t *state, void *user_data) {
+    log_dance("finished", state);
+}
+
+extern "C" void many_dances_reset(tap_dance_state_t *state, void *user_data) {
+    log_dance("reset", state);
+}
+
+extern "C" tap_dance_action_t *tap_dance_get(uint16_t tap_dance_idx) {
+    dance_lookups++;
+    return tap_dance_get_raw(tap_dance_idx);
+}
+
+/* Thirty tap dance keys spread over all the dances, and ten plain keys. Layer 1 has the last thirty
+ * dances in their place. */
+class ManyDances : public TestFixture {
+   public:
+    ManyDances() {
+        for (uint8_t i = 0; i < 30; i++) {
+            dances.push_back(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, TD(i * (MANY_DANCES / 30))));
+            last_dances.push_back(KeymapKey(1, i % MATRIX_COLS, i / MATRIX_COLS, TD(MANY_DANCES - 30 + i)));
+        }
+        for (uint8_t i = 0; i < 10; i++) {
+            plain.push_back(KeymapKey(0, i, 3, KC_A + i));
+            add_key(KeymapKey(1, i, 3, KC_A + i));
+        }
+        for (auto &key : dances) {
+            add_key(key);
+        }
+        for (auto &key : last_dances) {
+            add_key(key);
+        }
+        for (auto &key : plain) {
+            add_key(key);
+        }
+        dance_log.clear();
+    }
+
+    std::string dance(KeymapKey &key) {
+        return std::to_string(key.code - QK_TAP_DANCE);
+    }
+
+    std::vector<KeymapKey> dances;
+    std::vector<KeymapKey> last_dances;
+    std::vector<KeymapKey> plain;
+};
+
+TEST_F(ManyDances, every_dance_gets_its_own_taps) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    std::vector<std::string> expected;
+    for (auto &key : dances) {
+        tap_key(key);
+        tap_key(key);
+        idle_for(TAPPING_TERM + 1);
+        expected.insert(expected.end(), {"tap " + dance(key) + " x1", "tap " + dance(key) + " x2", "finished " + dance(key) + " x2", "reset " + dance(key) + " x2"});
+    }
+    EXPECT_EQ(dance_log, expected);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ManyDances, a_dance_past_the_pool_takes_the_place_of_one_held_down) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    /* Each dance is finished by the next one, and stays held. */
+    for (uint8_t i = 0; i < TAP_DANCE_MAX_SIMULTANEOUS; i++) {
+        dances[i].press();
+        run_one_scan_loop();
+        EXPECT_NE(tap_dance_get_state(dances[i].code - QK_TAP_DANCE), nullptr);
+    }
+    idle_for(TAPPING_TERM + 1);
+    dance_log.clear();
+
+    /* There is no state left for one more, so the first dance is reset to make room rather than the key
+     * being dropped. */
+    auto &extra = dances[TAP_DANCE_MAX_SIMULTANEOUS];
+    extra.press();
+    run_one_scan_loop();
+    EXPECT_EQ(tap_dance_get_state(dances[0].code - QK_TAP_DANCE), nullptr);
+    EXPECT_NE(tap_dance_get_state(extra.code - QK_TAP_DANCE), nullptr);
+    extra.release();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM + 1);
+    EXPECT_EQ(dance_log, std::vector<std::string>({"reset " + dance(dances[0]) + " x1", "tap " + dance(extra) + " x1", "finished " + dance(extra) + " x1", "reset " + dance(extra) + " x1"}));
+    dance_log.clear();
+
+    /* Letting go of the dance already reset does nothing more, the others reset as usual. */
+    std::vector<std::string> expected;
+    for (uint8_t i = 0; i < TAP_DANCE_MAX_SIMULTANEOUS; i++) {
+        dances[i].release();
+        run_one_scan_loop();
+        EXPECT_EQ(tap_dance_get_state(dances[i].code - QK_TAP_DANCE), nullptr);
+        if (i > 0) {
+            expected.push_back("reset " + dance(dances[i]) + " x1");
+        }
+    }
+    EXPECT_EQ(dance_log, expected);
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Not a benchmark as such; counts how often a dance is looked up while typing a pseudo random mix of
+ * dances, interrupted dances and plain keys, once over the first dances and once over the last. */
+TEST_F(ManyDances, lookups_do_not_depend_on_the_number_of_dances) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    auto type = [&](std::vector<KeymapKey> &dances) {
+        uint32_t seed = 0x1B873593, events = 0;
+        auto     next = [&](uint32_t range) {
+            seed = seed * 1664525 + 1013904223;
+            return (seed >> 8) % range;
+        };
+        dance_lookups = 0;
+        dance_log.clear();
+        for (uint16_t i = 0; i < 2000; i++) {
+            if (next(3) == 0) {
+                tap_key(plain[next(plain.size())]);
+            } else {
+                auto &key = dances[next(dances.size())];
+                for (uint8_t taps = 1 + next(3); taps > 0; taps--) {
+                    tap_key(key);
+                    events += 2;
+                }
+                if (next(2) == 0) {
+                    idle_for(TAPPING_TERM + 1);
+                }
+            }
+            events += 2;
+        }
+        idle_for(TAPPING_TERM + 1);
+
+        /* Nothing is looked up while no dance is going on. */
+        uint32_t lookups = dance_lookups;
+        idle_for(1000);
+        EXPECT_EQ(dance_lookups, lookups);
+        return (double)lookups / events;
+    };
+
+    double                   first = type(dances);
+    std::vector<std::string> first_log;
+    for (auto &entry : dance_log) {
+        first_log.push_back(entry.substr(0, entry.find(' ')));
+    }
+    layer_on(1);
+    double last = type(last_dances);
+    layer_off(1);
+
+    std::cout << MANY_DANCES << " tap dances, " << MANY_DANCES * sizeof(tap_dance_action_t) << " bytes of actions and " << TAP_DANCE_MAX_SIMULTANEOUS * sizeof(tap_dance_state_t) << " bytes of dance state: " << first << " lookups per key event over the first dances, " << last << " over the last" << std::endl;
+    EXPECT_EQ(first, last);
+    EXPECT_LT(first, 2);
+    std::vector<std::string> last_log;
+    for (auto &entry : dance_log) {
+        last_log.push_back(entry.substr(0, entry.find(' ')));
+    }
+    EXPECT_EQ(first_log, last_log);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define PERMISSIVE_HOLD_PER_KEY
+#define TAPPING_TERM_PER_KEY
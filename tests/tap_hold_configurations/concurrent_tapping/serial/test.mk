@@ -0,0 +1,9 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+# The same chords through the serial tapping engine, for comparison.
+SRC += tests/tap_hold_configurations/concurrent_tapping/test_chord_latency.cpp
@@ -0,0 +1,113 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iostream>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+/* Home row mods: GUI is never permissive, shift settles sooner than the rest. */
+extern "C" bool get_permissive_hold(uint16_t keycode, keyrecord_t *record) {
+    return keycode != LGUI_T(KC_A);
+}
+
+extern "C" uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    return keycode == LSFT_T(KC_F) ? TAPPING_TERM - 50 : TAPPING_TERM;
+}
+
+#ifdef CONCURRENT_TAPPING
+#    define TAPPING_ENGINE "concurrent"
+#else
+#    define TAPPING_ENGINE "serial"
+#endif
+
+class ChordLatency : public TestFixture {
+   public:
+    ChordLatency() {
+        set_keymap({key_a, key_s, key_d, key_f, key_j});
+    }
+
+    /* Presses the mod-taps in turn, taps J under them, then lets them go in reverse, and returns
+     * how long after J was released it was first reported, and with which mods. */
+    uint32_t chord(std::vector<KeymapKey *> mod_taps, uint32_t release_after, uint8_t *mods) {
+        TestDriver driver;
+        uint32_t   start = timer_read32(), reported = 0, released = 0;
+
+        *mods = 0;
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            for (uint8_t key : report.keys) {
+                if (key == KC_J && reported == 0) {
+                    reported = timer_read32();
+                    *mods    = report.mods;
+                }
+            }
+        }));
+
+        auto at = [&](uint32_t time) {
+            while (timer_read32() - start < time) {
+                run_one_scan_loop();
+            }
+        };
+        uint32_t time = 0;
+        for (auto key : mod_taps) {
+            at(time += 20);
+            key->press();
+        }
+        at(time += 20);
+        key_j.press();
+        at(time += 40);
+        released = timer_read32();
+        key_j.release();
+        run_one_scan_loop();
+        for (auto key = mod_taps.rbegin(); key != mod_taps.rend(); key++) {
+            at(time += release_after);
+            (*key)->release();
+        }
+        at(time + TAPPING_TERM * 2);
+        VERIFY_AND_CLEAR(driver);
+
+        EXPECT_NE(reported, 0);
+        return reported - released;
+    }
+
+    KeymapKey key_a = KeymapKey(0, 1, 0, LGUI_T(KC_A));
+    KeymapKey key_s = KeymapKey(0, 2, 0, LALT_T(KC_S));
+    KeymapKey key_d = KeymapKey(0, 3, 0, LCTL_T(KC_D));
+    KeymapKey key_f = KeymapKey(0, 4, 0, LSFT_T(KC_F));
+    KeymapKey key_j = KeymapKey(0, 7, 0, KC_J);
+};
+
+/* Not a benchmark as such; prints how long J waits under each chord, and with which mods it comes
+ * out. The serial engine lets every mod-tap after the first miss the J it was held for. */
+TEST_F(ChordLatency, chords_over_home_row_mods) {
+    struct Chord {
+        const char              *name;
+        std::vector<KeymapKey *> mod_taps;
+        uint32_t                 release_after;
+        uint8_t                  mods;
+        uint32_t                 latency;
+    };
+    const std::vector<Chord> chords = {
+        {"ctrl+shift+j", {&key_d, &key_f}, 20, MOD_BIT(KC_LCTL) | MOD_BIT(KC_LSFT), 0},
+        {"alt+ctrl+shift+j", {&key_s, &key_d, &key_f}, 20, MOD_BIT(KC_LALT) | MOD_BIT(KC_LCTL) | MOD_BIT(KC_LSFT), 0},
+        /* GUI is not permissive, so J waits for its tapping term, which ends 120ms after J is let go. */
+        {"gui+shift+j", {&key_a, &key_f}, 70, MOD_BIT(KC_LGUI) | MOD_BIT(KC_LSFT), TAPPING_TERM - 80},
+    };
+
+    for (auto &expected : chords) {
+        uint8_t  mods;
+        uint32_t latency = chord(expected.mod_taps, expected.release_after, &mods);
+        std::cout << TAPPING_ENGINE << " " << expected.name << ": j " << latency << "ms after its release, mods 0x" << std::hex << +mods << std::dec << std::endl;
+#ifdef CONCURRENT_TAPPING
+        EXPECT_EQ(mods, expected.mods) << expected.name;
+        EXPECT_LE(latency, expected.latency) << expected.name;
+#endif
+    }
+}
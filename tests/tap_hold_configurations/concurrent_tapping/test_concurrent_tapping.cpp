@@ -0,0 +1,133 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+/* get_permissive_hold() and get_tapping_term() are in test_chord_latency.cpp: every mod-tap but
+ * GUI is permissive, and shift's tapping term is 50ms shorter. */
+class ConcurrentTapping : public TestFixture {
+   public:
+    ConcurrentTapping() {
+        set_keymap({key_a, key_d, key_f, key_j});
+    }
+
+    KeymapKey key_a = KeymapKey(0, 1, 0, LGUI_T(KC_A));
+    KeymapKey key_d = KeymapKey(0, 3, 0, LCTL_T(KC_D));
+    KeymapKey key_f = KeymapKey(0, 4, 0, LSFT_T(KC_F));
+    KeymapKey key_j = KeymapKey(0, 7, 0, KC_J);
+};
+
+TEST_F(ConcurrentTapping, permissive_mod_taps_are_held_together) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_NO_REPORT(driver);
+    key_d.press();
+    idle_for(20);
+    key_f.press();
+    idle_for(20);
+    key_j.press();
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Releasing J settles both mod-taps as held. */
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT, KC_J));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    key_j.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_EMPTY_REPORT(driver);
+    key_f.release();
+    run_one_scan_loop();
+    key_d.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ConcurrentTapping, each_mod_tap_uses_its_own_permissive_hold) {
+    TestDriver driver;
+    InSequence s;
+
+    /* J is nested in both, and shift is let go before GUI's tapping term ends. */
+    EXPECT_NO_REPORT(driver);
+    key_a.press();
+    idle_for(20);
+    key_f.press();
+    idle_for(20);
+    tap_key(key_j);
+    idle_for(50);
+    key_f.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* GUI waits for its tapping term, shift was held for J all along. */
+    EXPECT_REPORT(driver, (KC_LGUI));
+    EXPECT_REPORT(driver, (KC_LGUI, KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LGUI, KC_LSFT, KC_J));
+    EXPECT_REPORT(driver, (KC_LGUI, KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LGUI));
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ConcurrentTapping, rolled_mod_taps_are_tapped_in_order) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_F));
+    EXPECT_EMPTY_REPORT(driver);
+    key_d.press();
+    idle_for(20);
+    key_f.press();
+    idle_for(20);
+    key_d.release();
+    idle_for(20);
+    key_f.release();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ConcurrentTapping, mod_tap_behind_a_hold_is_settled_by_its_own_tapping_term) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_NO_REPORT(driver);
+    key_d.press();
+    idle_for(20);
+    key_f.press();
+    idle_for(TAPPING_TERM - 30);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Shift's shorter tapping term has run out by the time ctrl's does. */
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_EMPTY_REPORT(driver);
+    key_f.release();
+    run_one_scan_loop();
+    key_d.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
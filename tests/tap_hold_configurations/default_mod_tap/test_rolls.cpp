@@ -0,0 +1,163 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::Invoke;
+using testing::InSequence;
+
+/* Twelve home row style mod-taps, and twelve plain keys. */
+class RollTapHold : public TestFixture {
+   public:
+    RollTapHold() {
+        const uint16_t mods[] = {MOD_LSFT, MOD_LCTL, MOD_LALT, MOD_LGUI};
+        for (uint8_t i = 0; i < 12; i++) {
+            mod_taps.push_back(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, MT(mods[i % 4], KC_A + i)));
+            plain.push_back(KeymapKey(0, (i + 12) % MATRIX_COLS, (i + 12) / MATRIX_COLS, KC_M + i));
+        }
+        for (auto &key : mod_taps) {
+            add_key(key);
+        }
+        for (auto &key : plain) {
+            add_key(key);
+        }
+    }
+
+    /* Records the keys each report adds, in order, and whether any report carried mods. */
+    void record_reports(TestDriver &driver) {
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(Invoke([this](report_keyboard_t &report) {
+            std::vector<uint8_t> keys;
+            for (uint8_t key : report.keys) {
+                if (key != KC_NO) {
+                    keys.push_back(key);
+                    if (std::find(held.begin(), held.end(), key) == held.end()) {
+                        typed.push_back(key);
+                    }
+                }
+            }
+            held = keys;
+            mods_seen |= report.mods != 0;
+        }));
+    }
+
+    std::vector<KeymapKey> mod_taps;
+    std::vector<KeymapKey> plain;
+    std::vector<uint8_t>   typed;
+    std::vector<uint8_t>   held;
+    bool                   mods_seen = false;
+};
+
+TEST_F(RollTapHold, roll_across_twelve_mod_taps_types_every_tap) {
+    TestDriver driver;
+    InSequence s;
+
+    /* Each key goes down before the one before it comes up. */
+    for (uint8_t i = 0; i < mod_taps.size(); i++) {
+        EXPECT_REPORT(driver, (KC_A + i));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    for (uint8_t i = 0; i <= mod_taps.size(); i++) {
+        if (i < mod_taps.size()) {
+            mod_taps[i].press();
+            run_one_scan_loop();
+        }
+        idle_for(10);
+        if (i > 0) {
+            mod_taps[i - 1].release();
+            run_one_scan_loop();
+        }
+        idle_for(10);
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(RollTapHold, twelve_keys_under_a_held_mod_tap_are_not_dropped) {
+    TestDriver driver;
+    InSequence s;
+
+    /* Twelve taps under the mod-tap, well within TAPPING_TERM, are more events than the waiting
+     * buffer holds. The mod-tap is settled as a hold instead of the buffer being thrown away. */
+    EXPECT_REPORT(driver, (KC_LSFT));
+    for (auto &key : plain) {
+        EXPECT_REPORT(driver, (KC_LSFT, key.code));
+        EXPECT_REPORT(driver, (KC_LSFT));
+    }
+    EXPECT_EMPTY_REPORT(driver);
+
+    mod_taps[0].press();
+    run_one_scan_loop();
+    for (auto &key : plain) {
+        key.press();
+        run_one_scan_loop();
+        key.release();
+        run_one_scan_loop();
+    }
+    mod_taps[0].release();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Long pseudo random rolls, several keys down at once, every key released within TAPPING_TERM.
+ * Default mod-taps tap in that case, so every key must come out once, in the order pressed. */
+TEST_F(RollTapHold, random_rolls_type_every_key_in_order) {
+    TestDriver driver;
+    record_reports(driver);
+
+    struct Event {
+        uint32_t time;
+        uint8_t  key;
+        bool     pressed;
+    };
+    std::vector<Event>    events;
+    std::vector<uint8_t>  expected;
+    std::vector<uint32_t> released_at(mod_taps.size(), 0);
+    uint32_t              seed = 0x6D2B79F5;
+    auto                  next = [&](uint32_t range) {
+        seed = seed * 1664525 + 1013904223;
+        return (seed >> 8) % range;
+    };
+
+    uint32_t now = 0;
+    for (uint16_t i = 0; i < 1000; i++) {
+        now += 15 + next(25);
+        uint8_t key;
+        do {
+            key = next(mod_taps.size());
+        } while (released_at[key] >= now);
+        released_at[key] = now + 20 + next(60);
+        events.push_back({now, key, true});
+        events.push_back({released_at[key], key, false});
+        expected.push_back(KC_A + key);
+    }
+    std::stable_sort(events.begin(), events.end(), [](const Event &a, const Event &b) { return a.time < b.time; });
+
+    uint32_t time = 0;
+    for (auto &event : events) {
+        if (event.time > time) {
+            idle_for(event.time - time - 1);
+            time = event.time;
+        }
+        if (event.pressed) {
+            mod_taps[event.key].press();
+        } else {
+            mod_taps[event.key].release();
+        }
+        run_one_scan_loop();
+    }
+    idle_for(TAPPING_TERM * 2);
+
+    EXPECT_EQ(typed, expected);
+    EXPECT_FALSE(mods_seen);
+    EXPECT_TRUE(held.empty());
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,167 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+class UnicodeAsync : public TestFixture {
+   public:
+    /* Runs the main loop until the queue is empty, returning the number of scans that took. */
+    uint16_t drain(void) {
+        uint16_t scans = 0;
+        while (scans < 1000 && !unicode_queue_empty()) {
+            run_one_scan_loop();
+            scans++;
+        }
+        EXPECT_TRUE(unicode_queue_empty());
+        return scans;
+    }
+};
+
+TEST_F(UnicodeAsync, types_out_over_several_scans) {
+    TestDriver driver;
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    EXPECT_NO_REPORT(driver);
+    uint32_t start = timer_read32();
+    register_unicode(0x03A8); // Ψ
+    EXPECT_EQ(timer_read32(), start);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_UNICODE(driver, 0x03A8);
+    EXPECT_GT(drain(), 10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, sends_surrogate_pair_for_macos) {
+    TestDriver driver;
+    set_unicode_input_mode(UNICODE_MODE_MACOS);
+
+    {
+        testing::InSequence s;
+
+        // Alt+D83EDDD9 🧙
+        EXPECT_REPORT(driver, (KC_LEFT_ALT));
+        for (uint8_t key : {KC_D, KC_8, KC_3, KC_E, KC_D, KC_D, KC_D, KC_9}) {
+            EXPECT_REPORT(driver, (key, KC_LEFT_ALT));
+            EXPECT_REPORT(driver, (KC_LEFT_ALT));
+        }
+        EXPECT_EMPTY_REPORT(driver);
+    }
+
+    register_unicode(0x1F9D9);
+    drain();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, waits_without_blocking_and_restores_num_lock) {
+    TestDriver driver;
+    set_unicode_input_mode(UNICODE_MODE_WINDOWS);
+
+    std::vector<std::pair<uint32_t, std::vector<uint8_t>>> reports;
+    EXPECT_ANY_REPORT(driver).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+        std::vector<uint8_t> keys;
+        for (uint8_t key : report.keys) {
+            if (key != KC_NO) {
+                keys.push_back(key);
+            }
+        }
+        reports.push_back({timer_read32(), keys});
+    }));
+
+    register_unicode(0x00E9); // é
+    drain();
+    VERIFY_AND_CLEAR(driver);
+
+    std::vector<std::vector<uint8_t>> keys;
+    for (auto &report : reports) {
+        keys.push_back(report.second);
+    }
+    /* Alt is held as a modifier, and does not show up in the keys. */
+    EXPECT_EQ(keys, std::vector<std::vector<uint8_t>>({{KC_NUM_LOCK}, {}, {}, {KC_KP_PLUS}, {}, {KC_KP_0}, {}, {KC_KP_0}, {}, {KC_E}, {}, {KC_KP_9}, {}, {}, {KC_NUM_LOCK}, {}}));
+    /* The plus goes out once UNICODE_TYPE_DELAY is up, and the digits once it is up again. */
+    EXPECT_GE(reports[3].first - reports[2].first, UNICODE_TYPE_DELAY);
+    EXPECT_GE(reports[5].first - reports[4].first, UNICODE_TYPE_DELAY);
+    EXPECT_LT(reports.back().first - reports.front().first, 2 * UNICODE_TYPE_DELAY + reports.size());
+}
+
+TEST_F(UnicodeAsync, queues_strings_across_code_points) {
+    TestDriver driver;
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    {
+        testing::InSequence s;
+        for (uint32_t code_point : {0x1F600, 0x1F389, 0x2603, 0x1F680}) {
+            EXPECT_UNICODE(driver, code_point);
+        }
+    }
+
+    /* Four code points do not fit in the queue, so typing the first ones out makes room. */
+    uint32_t start = timer_read32();
+    send_unicode_string("😀🎉☃🚀");
+    EXPECT_GT(timer_read32(), start);
+    EXPECT_FALSE(unicode_queue_empty());
+    drain();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, other_keys_wait_for_the_code_point) {
+    TestDriver driver;
+    auto       key_uc = KeymapKey(0, 0, 0, UC(0x03A8));
+    auto       key_j  = KeymapKey(0, 1, 0, KC_J);
+    set_keymap({key_uc, key_j});
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    {
+        testing::InSequence s;
+        EXPECT_UNICODE(driver, 0x03A8);
+        EXPECT_UNICODE(driver, 0x03A8);
+        EXPECT_REPORT(driver, (KC_J));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+
+    /* A second tap is queued behind the first, J has to wait for both. */
+    tap_key(key_uc);
+    tap_key(key_uc);
+    EXPECT_FALSE(unicode_queue_empty());
+    tap_key(key_j);
+    EXPECT_TRUE(unicode_queue_empty());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeAsync, restores_mods_unless_released_while_typing) {
+    TestDriver driver;
+    auto       key_uc    = KeymapKey(0, 0, 0, UC(0x03A8));
+    auto       key_shift = KeymapKey(0, 1, 0, KC_LEFT_SHIFT);
+    set_keymap({key_uc, key_shift});
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    {
+        testing::InSequence s;
+        EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+        EXPECT_UNICODE(driver, 0x03A8);
+        EXPECT_UNICODE(driver, 0x03A8);
+    }
+
+    key_shift.press();
+    run_one_scan_loop();
+    tap_key(key_uc);
+    drain();
+    EXPECT_EQ(get_mods(), MOD_BIT(KC_LEFT_SHIFT));
+
+    /* Released in the middle of the next one, which is typed out first. */
+    tap_key(key_uc);
+    run_one_scan_loop();
+    key_shift.release();
+    run_one_scan_loop();
+    EXPECT_TRUE(unicode_queue_empty());
+    EXPECT_EQ(get_mods(), 0);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define EEPROM_SIZE 4096
+
+#define DYNAMIC_KEYMAP_LAYER_COUNT 16
+
+#define VIA_BULK_TRANSFER_ENABLE
@@ -0,0 +1,272 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <iostream>
+#include <vector>
+#include "test_common.hpp"
+#include "tests/dynamic_keymap/eeprom_counting.h"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "raw_hid.h"
+#include "via.h"
+}
+
+using testing::_;
+using report_t = std::array<uint8_t, 32>;
+
+/* Emulates the host end of the raw HID endpoint, collecting everything the keyboard sends. */
+static std::deque<report_t> from_keyboard;
+
+extern "C" void raw_hid_send(uint8_t *data, uint8_t length) {
+    report_t report{};
+    std::copy(data, data + length, report.begin());
+    from_keyboard.push_back(report);
+}
+
+static uint16_t crc16(uint16_t crc, const uint8_t *data, size_t length) {
+    while (length--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+class ViaBulkTransfer : public TestFixture {
+   protected:
+    TestDriver driver;
+    unsigned   round_trips = 0;
+
+    void SetUp() override {
+        from_keyboard.clear();
+        EXPECT_NO_REPORT(driver);
+    }
+
+    void TearDown() override {
+        VERIFY_AND_CLEAR(driver);
+    }
+
+    static void send(report_t report) {
+        raw_hid_receive(report.data(), report.size());
+    }
+
+    /* Sends a report and waits for its response, the way VIA talks to the keyboard. */
+    report_t request(report_t report) {
+        round_trips++;
+        send(report);
+        EXPECT_FALSE(from_keyboard.empty()) << "No response to command " << +report[0];
+        report_t response = from_keyboard.front();
+        from_keyboard.pop_front();
+        return response;
+    }
+
+    static report_t start(uint8_t op, uint8_t region, uint16_t offset, uint16_t length) {
+        return {VIA_BULK_TRANSFER_COMMAND_ID, op, region, (uint8_t)(offset >> 8), (uint8_t)offset, (uint8_t)(length >> 8), (uint8_t)length};
+    }
+
+    static uint16_t region_size(uint8_t region) {
+        return region == id_bulk_region_keymap ? dynamic_keymap_get_layer_count() * MATRIX_ROWS * MATRIX_COLS * 2 : dynamic_keymap_macro_get_buffer_size();
+    }
+
+    /* Reads with the original command, 28 bytes per round trip. */
+    std::vector<uint8_t> legacy_read_keymap() {
+        std::vector<uint8_t> data(region_size(id_bulk_region_keymap));
+        for (uint16_t offset = 0; offset < data.size(); offset += 28) {
+            uint8_t  size     = std::min<size_t>(28, data.size() - offset);
+            report_t response = request({id_dynamic_keymap_get_buffer, (uint8_t)(offset >> 8), (uint8_t)offset, size});
+            std::copy(&response[4], &response[4] + size, &data[offset]);
+        }
+        return data;
+    }
+
+    /* Starts a bulk read, then keeps the keyboard running until the end report arrives. */
+    std::vector<uint8_t> bulk_read(uint8_t region, uint16_t offset, uint16_t length, unsigned *scans = nullptr) {
+        std::vector<uint8_t> data;
+        report_t             response = request(start(id_bulk_read_start, region, offset, length));
+        EXPECT_EQ(response[7], id_bulk_status_ok);
+        if (response[7] != id_bulk_status_ok) {
+            return data;
+        }
+
+        uint8_t  sequence = 0;
+        uint16_t crc      = 0xFFFF;
+        for (unsigned scan = 0; scan < 1000; scan++) {
+            run_one_scan_loop();
+            while (!from_keyboard.empty()) {
+                report_t report = from_keyboard.front();
+                from_keyboard.pop_front();
+                EXPECT_EQ(report[0], VIA_BULK_TRANSFER_COMMAND_ID);
+                EXPECT_EQ(report[2], sequence) << "Report out of sequence";
+                if (report[1] == id_bulk_end) {
+                    EXPECT_EQ(report[5], id_bulk_status_ok);
+                    EXPECT_EQ((report[3] << 8) | report[4], crc) << "Checksum mismatch";
+                    if (scans) *scans = scan + 1;
+                    return data;
+                }
+                EXPECT_EQ(report[1], id_bulk_data);
+                size_t size = std::min<size_t>(VIA_BULK_PAYLOAD_SIZE, length - data.size());
+                data.insert(data.end(), &report[3], &report[3] + size);
+                crc = crc16(crc, &report[3], size);
+                sequence++;
+            }
+        }
+        ADD_FAILURE() << "Bulk read never finished";
+        return data;
+    }
+
+    /* Streams a bulk write without waiting between data reports, returning the status of the end report. */
+    uint8_t bulk_write(uint8_t region, uint16_t offset, const std::vector<uint8_t> &data, uint16_t crc_xor = 0) {
+        report_t response = request(start(id_bulk_write_start, region, offset, data.size()));
+        if (response[7] != id_bulk_status_ok) {
+            return response[7];
+        }
+
+        uint8_t  sequence = 0;
+        uint16_t crc      = 0xFFFF;
+        for (size_t position = 0; position < data.size(); position += VIA_BULK_PAYLOAD_SIZE) {
+            size_t   size   = std::min<size_t>(VIA_BULK_PAYLOAD_SIZE, data.size() - position);
+            report_t report = {VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_data, sequence++};
+            std::copy(&data[position], &data[position] + size, &report[3]);
+            crc = crc16(crc, &data[position], size);
+            send(report);
+        }
+        EXPECT_TRUE(from_keyboard.empty()) << "Data reports should not be answered";
+
+        crc ^= crc_xor;
+        response = request({VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_end, sequence, (uint8_t)(crc >> 8), (uint8_t)crc});
+        EXPECT_EQ(response[1], id_bulk_end);
+        return response[5];
+    }
+
+    static std::vector<uint8_t> pattern(size_t length, uint8_t seed) {
+        std::vector<uint8_t> data(length);
+        for (size_t i = 0; i < length; i++) {
+            data[i] = (uint8_t)(seed + i * 7 + (i >> 8));
+        }
+        return data;
+    }
+};
+
+TEST_F(ViaBulkTransfer, keymap_read_matches_legacy_commands) {
+    auto expected = pattern(region_size(id_bulk_region_keymap), 0x11);
+    dynamic_keymap_set_buffer(0, expected.size(), expected.data());
+
+    unsigned scans        = 0;
+    unsigned legacy_trips = 0;
+    auto     bulk         = bulk_read(id_bulk_region_keymap, 0, expected.size(), &scans);
+    unsigned bulk_trips   = round_trips;
+    auto     legacy       = legacy_read_keymap();
+    legacy_trips          = round_trips - bulk_trips;
+
+    EXPECT_EQ(bulk, expected);
+    EXPECT_EQ(legacy, expected);
+    std::cout << "Keymap read of " << expected.size() << " bytes: " << legacy_trips << " round trips with id_dynamic_keymap_get_buffer, " << bulk_trips << " with bulk transfer (" << scans << " scan loops)" << std::endl;
+}
+
+TEST_F(ViaBulkTransfer, partial_read_of_macros) {
+    auto expected = pattern(100, 0x42);
+    dynamic_keymap_macro_set_buffer(37, expected.size(), expected.data());
+    EXPECT_EQ(bulk_read(id_bulk_region_macro, 37, expected.size()), expected);
+}
+
+TEST_F(ViaBulkTransfer, macro_write_round_trip) {
+    auto     expected = pattern(region_size(id_bulk_region_macro), 0x5A);
+    uint32_t writes   = eeprom_counting_writes;
+    EXPECT_EQ(bulk_write(id_bulk_region_macro, 0, expected), id_bulk_status_ok);
+
+    /* Staged data is written a block at a time. */
+    size_t staging = VIA_BULK_PAYLOAD_SIZE * 4;
+    EXPECT_LE(eeprom_counting_writes - writes, (expected.size() + staging - 1) / staging);
+
+    std::vector<uint8_t> readback(expected.size());
+    dynamic_keymap_macro_get_buffer(0, readback.size(), readback.data());
+    EXPECT_EQ(readback, expected);
+    EXPECT_EQ(bulk_read(id_bulk_region_macro, 0, expected.size()), expected);
+}
+
+TEST_F(ViaBulkTransfer, keymap_write_round_trip) {
+    auto expected = pattern(region_size(id_bulk_region_keymap), 0x23);
+    EXPECT_EQ(bulk_write(id_bulk_region_keymap, 0, expected), id_bulk_status_ok);
+    EXPECT_EQ(legacy_read_keymap(), expected);
+}
+
+TEST_F(ViaBulkTransfer, checksum_mismatch_is_reported) {
+    /* The data has already gone through to EEPROM, so the host is told to write it again. */
+    EXPECT_EQ(bulk_write(id_bulk_region_macro, 0, pattern(64, 1), 0x0100), id_bulk_status_checksum_error | id_bulk_status_resend_range);
+}
+
+TEST_F(ViaBulkTransfer, abort_after_a_partial_write_asks_for_the_whole_range) {
+    auto before = pattern(VIA_BULK_PAYLOAD_SIZE * 6, 0x40);
+    dynamic_keymap_macro_set_buffer(0, before.size(), before.data());
+
+    auto data = pattern(before.size(), 0x90);
+    EXPECT_EQ(request(start(id_bulk_write_start, id_bulk_region_macro, 0, data.size()))[7], id_bulk_status_ok);
+    for (uint8_t sequence = 0; sequence < 5; sequence++) {
+        report_t report = {VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_data, sequence};
+        std::copy(&data[sequence * VIA_BULK_PAYLOAD_SIZE], &data[(sequence + 1) * VIA_BULK_PAYLOAD_SIZE], &report[3]);
+        send(report);
+    }
+    EXPECT_TRUE(from_keyboard.empty());
+
+    /* Report 5 went missing, after the first staging buffer was written. */
+    send({VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_data, 6});
+    ASSERT_EQ(from_keyboard.size(), 1);
+    EXPECT_EQ(from_keyboard.front()[5], id_bulk_status_sequence_error | id_bulk_status_resend_range);
+    from_keyboard.clear();
+
+    std::vector<uint8_t> readback(data.size());
+    dynamic_keymap_macro_get_buffer(0, readback.size(), readback.data());
+    size_t written = VIA_BULK_PAYLOAD_SIZE * 4;
+    EXPECT_TRUE(std::equal(data.begin(), data.begin() + written, readback.begin()));
+    EXPECT_TRUE(std::equal(before.begin() + written, before.end(), readback.begin() + written));
+
+    /* Writing the whole range again recovers. */
+    EXPECT_EQ(bulk_write(id_bulk_region_macro, 0, data), id_bulk_status_ok);
+    dynamic_keymap_macro_get_buffer(0, readback.size(), readback.data());
+    EXPECT_EQ(readback, data);
+}
+
+TEST_F(ViaBulkTransfer, out_of_sequence_report_aborts) {
+    EXPECT_EQ(request(start(id_bulk_write_start, id_bulk_region_macro, 0, 100))[7], id_bulk_status_ok);
+    send({VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_data, 0});
+    EXPECT_TRUE(from_keyboard.empty());
+
+    /* Report 1 went missing, before anything was written. */
+    send({VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_data, 2});
+    ASSERT_EQ(from_keyboard.size(), 1);
+    EXPECT_EQ(from_keyboard.front()[1], id_bulk_end);
+    EXPECT_EQ(from_keyboard.front()[2], 1);
+    EXPECT_EQ(from_keyboard.front()[5], id_bulk_status_sequence_error);
+    from_keyboard.clear();
+
+    /* The transfer is over, so the rest is rejected. */
+    EXPECT_EQ(request({VIA_BULK_TRANSFER_COMMAND_ID, id_bulk_data, 3})[5], id_bulk_status_invalid);
+}
+
+TEST_F(ViaBulkTransfer, out_of_range_is_rejected) {
+    uint16_t size = region_size(id_bulk_region_keymap);
+    EXPECT_EQ(request(start(id_bulk_read_start, id_bulk_region_keymap, size - 10, 11))[7], id_bulk_status_invalid);
+    EXPECT_EQ(request(start(id_bulk_write_start, 0x7F, 0, 1))[7], id_bulk_status_invalid);
+    run_one_scan_loop();
+    EXPECT_TRUE(from_keyboard.empty());
+}
+
+TEST_F(ViaBulkTransfer, other_commands_are_answered_while_streaming) {
+    auto expected = pattern(region_size(id_bulk_region_keymap), 0x77);
+    dynamic_keymap_set_buffer(0, expected.size(), expected.data());
+    EXPECT_EQ(request(start(id_bulk_read_start, id_bulk_region_keymap, 0, expected.size()))[7], id_bulk_status_ok);
+    run_one_scan_loop();
+    from_keyboard.clear();
+
+    report_t response = request({id_get_protocol_version});
+    EXPECT_EQ(response[0], id_get_protocol_version);
+    EXPECT_EQ((response[1] << 8) | response[2], VIA_PROTOCOL_VERSION);
+
+    /* A new transfer replaces the one in progress. */
+    EXPECT_EQ(bulk_read(id_bulk_region_keymap, 0, 64), std::vector<uint8_t>(expected.begin(), expected.begin() + 64));
+}